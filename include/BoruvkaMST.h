@@ -0,0 +1,40 @@
+#ifndef BORUVKA_MST_H
+#define BORUVKA_MST_H
+
+#include "WeightedGraph.h"
+#include "CSRGraph.h"
+#include "UndirectedGraph.h"
+#include "SpanningResult.h"
+#include <vector>
+
+class BoruvkaMST {
+public:
+    /**
+     * Floresta geradora mínima pelo algoritmo de Borůvka, com as rodadas em paralelo
+     * (ver Parallel): cada componente acha a sua aresta de saída mais leve, as
+     * componentes são contraídas num conjunto disjunto concorrente e as arestas que
+     * ficaram internas saem da lista. São O(log V) rodadas.
+     * Empates são desfeitos por (peso, posição da aresta na entrada), a mesma ordem
+     * total do KruskalMST: as duas florestas (e os vetores de pais) são idênticas.
+     * Instanciado para os tipos de peso de FOR_EACH_WEIGHT_TYPE.
+     */
+    template <typename W>
+    static BasicSpanningForestResult<W> obterFlorestaGeradora(const BasicWeightedGraph<W>& grafoEntrada);
+    template <typename W>
+    static BasicSpanningForestResult<W> obterFlorestaGeradora(const BasicCSRGraph<W>& grafoEntrada);
+    template <typename W>
+    static BasicSpanningForestResult<W> obterFlorestaGeradora(const BasicUndirectedGraph<W>& grafoEntrada);
+
+    // Adaptador: a mesma floresta materializada num WeightedGraph
+    template <typename W>
+    static BasicWeightedGraph<W> obterArvoreGeradoraMinima(const BasicWeightedGraph<W>& grafoEntrada);
+
+    /**
+     * Núcleo comum sobre as arestas candidatas (u < v); a posição de cada aresta na
+     * lista desfaz os empates. totalCost fica por conta de locateEdges.
+     */
+    template <typename W>
+    static BasicSpanningForestResult<W> construirFloresta(int numVertices, const std::vector<BasicWeightedEdge<W>>& listaArestas);
+};
+
+#endif // BORUVKA_MST_H
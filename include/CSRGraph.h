@@ -0,0 +1,94 @@
+#ifndef CSRGRAPH_H
+#define CSRGRAPH_H
+
+#include <memory>
+#include <span>
+#include <vector>
+#include "WeightedEdge.h"
+#include "WeightedGraph.h"
+#include "GraphStats.h"
+
+/**
+ * Fotografia imutável de um WeightedGraph no formato CSR (Compressed Sparse Row).
+ * As arestas de saída do vértice v ocupam o intervalo [offsets[v], offsets[v+1])
+ * dos vetores contíguos de destinos e pesos, evitando uma alocação por vértice.
+ * Construída uma única vez em O(V + E); alterações posteriores no grafo de origem
+ * não são refletidas.
+ * Os arrays são acessados por ponteiro e mantidos vivos por um dono compartilhado
+ * (vetores próprios ou um arquivo mapeado, ver GraphFile): como a fotografia é
+ * imutável, cópias compartilham os mesmos dados e várias threads podem lê-la
+ * ao mesmo tempo sem sincronização.
+ */
+template <typename W>
+class BasicCSRGraph {
+public:
+    using Weight = W;
+    using Edge = BasicWeightedEdge<W>;
+
+private:
+    int numV;
+    int numE;
+    bool directed;
+    const int* offsets;            // V + 1 posições
+    const int* targets;            // E posições
+    const W* weights;              // E posições
+    std::shared_ptr<const void> dono;
+
+public:
+    explicit BasicCSRGraph(const BasicWeightedGraph<W>& grafo);
+
+    /**
+     * Montagem paralela a partir de uma lista de arestas em qualquer ordem: histogramas
+     * de grau por thread, soma de prefixos e distribuição paralela; depois as repetições
+     * de cada lista são combinadas segundo `politica`, na posição da primeira ocorrência.
+     * Cada lista fica na ordem da entrada, como numa sequência serial de insertEdge num
+     * WeightedGraph vazio (com KEEP_FIRST o resultado é o mesmo), independente do número
+     * de threads.
+     * Em grafos não-direcionados cada aresta entra nas listas das duas pontas.
+     * As threads são limitadas a E / V, para que os histogramas somem O(V + E).
+     * Vértice fora de [0, V), ou mais de INT32_MAX entradas nas listas (2 por aresta
+     * sem direção), lança std::invalid_argument.
+     */
+    static BasicCSRGraph fromEdges(int V, std::span<const Edge> arestas, bool directed,
+                                   DuplicatePolicy politica = DuplicatePolicy::KEEP_FIRST);
+
+    // Fotografia sobre arrays externos, sem cópia; `dono` mantém a memória válida
+    BasicCSRGraph(int V, int E, bool directed, const int* offsets, const int* targets,
+                  const W* weights, std::shared_ptr<const void> dono);
+
+    int V() const { return numV; }
+    int E() const { return numE; }
+    bool isDirected() const { return directed; }
+
+    // Intervalo [firstEdge(v), lastEdge(v)) das arestas de saída de v
+    int firstEdge(int v) const { return offsets[v]; }
+    int lastEdge(int v) const { return offsets[v + 1]; }
+    int degree(int v) const { return offsets[v + 1] - offsets[v]; }
+
+    int target(int e) const { return targets[e]; }
+    W weight(int e) const { return weights[e]; }
+
+    // Bytes dos três arrays (próprios ou mapeados)
+    size_t memoryUsage() const;
+    GraphStats stats() const;
+
+    // Arrays contíguos subjacentes (serialização, ver GraphFile)
+    const int* offsetData() const { return offsets; }
+    const int* targetData() const { return targets; }
+    const W* weightData() const { return weights; }
+
+    // Iterator (mesma interface de WeightedGraph::AdjIterator)
+    class AdjIterator {
+        const BasicCSRGraph& G;
+        int v, index;
+    public:
+        AdjIterator(const BasicCSRGraph& G, int v);
+        Edge begin();
+        Edge next();
+        bool end() const;
+    };
+};
+
+using CSRGraph = BasicCSRGraph<double>;
+
+#endif
@@ -0,0 +1,151 @@
+#ifndef COMPRESSEDGRAPH_H
+#define COMPRESSEDGRAPH_H
+
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <string>
+#include <vector>
+#include "WeightedEdge.h"
+#include "WeightedGraph.h"
+#include "CSRGraph.h"
+#include "EdgeListReader.h"
+#include "GraphStats.h"
+
+/**
+ * Fotografia somente leitura com adjacência comprimida, para grafos que não cabem
+ * em memória como listas de Edge. Cada lista é ordenada por destino e guardada como
+ * diferenças codificadas em varint (7 bits por byte; o primeiro destino é relativo
+ * ao próprio vértice, em zigzag). Os pesos ficam num vetor separado, na mesma ordem.
+ * Em grafos não-direcionados cada aresta é guardada uma só vez, na lista da menor
+ * ponta: neighbors(v) traz apenas os vizinhos w >= v e edges() cada aresta uma vez.
+ * Listas esparsas com rótulos próximos gastam 1 a 2 bytes por destino em vez de 4.
+ *
+ * Para nunca ter o grafo descomprimido em memória, monte com fromEdgeSource ou
+ * fromEdgeList (fluxo em blocos). O KruskalMST consome os cursores direto; Edmonds,
+ * Tarjan e Gabow decodificam tudo para BasicEdgeArrays, então para eles este é só um
+ * formato de armazenamento: o pico de memória inclui o grafo decodificado.
+ */
+template <typename W>
+class BasicCompressedGraph {
+public:
+    using Weight = W;
+    using Edge = BasicWeightedEdge<W>;
+
+private:
+    int numV;
+    int numE;
+    bool directed;
+    std::vector<uint64_t> inicioBytes;   // V + 1 posições em `dados`
+    std::vector<int> inicioArestas;      // V + 1 posições em `pesos`
+    std::vector<uint8_t> dados;
+    std::vector<W> pesos;
+
+    BasicCompressedGraph(int V, bool directed);
+
+    // Ordena a lista de v por destino e a codifica ao fim de `dados`
+    void appendList(int v, std::span<std::pair<int, W>> lista);
+
+public:
+    explicit BasicCompressedGraph(const BasicWeightedGraph<W>& grafo);
+    explicit BasicCompressedGraph(const BasicCSRGraph<W>& grafo);
+
+    /**
+     * Fonte de arestas que pode ser percorrida várias vezes: cada chamada entrega a
+     * entrada inteira, em blocos, ao consumidor recebido.
+     */
+    using EdgeSource = std::function<void(const std::function<void(std::span<const Edge>)>&)>;
+
+    /**
+     * Monta sem materializar o grafo: uma passada conta os graus e as seguintes
+     * codificam faixas de vértices cujas listas somam até arestasPorPassada arestas.
+     * Pico de memória: o resultado, O(V) e um buffer de arestasPorPassada pares.
+     * Cada aresta da fonte é uma aresta (não-direcionada: guardada na menor ponta);
+     * repetidas são mantidas. Vértice fora de [0, V) lança std::invalid_argument.
+     */
+    static BasicCompressedGraph fromEdgeSource(int V, bool directed, const EdgeSource& fonte,
+                                               size_t arestasPorPassada = 1 << 24);
+    // Lista de arestas já em memória (duas passadas sobre ela)
+    static BasicCompressedGraph fromEdges(int V, std::span<const Edge> arestas, bool directed);
+    // Direto do arquivo texto, em blocos de EdgeListReader::forEachChunk
+    static BasicCompressedGraph fromEdgeList(const std::string& caminho, bool directed,
+                                             EdgeListFormat formato = EdgeListFormat::AUTO,
+                                             size_t arestasPorPassada = 1 << 24);
+
+    int V() const { return numV; }
+    int E() const { return numE; }       // arestas guardadas (não-direcionadas contam uma vez)
+    bool isDirected() const { return directed; }
+    int degree(int v) const { return inicioArestas[v + 1] - inicioArestas[v]; }
+
+    // Bytes ocupados pelas listas, pesos e índices
+    size_t memoryUsage() const;
+    GraphStats stats() const;
+
+    // Decodifica uma lista sob demanda: cada ++ lê um varint
+    class Cursor {
+        const uint8_t* p = nullptr;
+        const W* peso = nullptr;
+        int v = -1, w = -1, restantes = 0;
+
+        uint32_t lerVarint() {
+            uint32_t x = 0;
+            int deslocamento = 0;
+            uint8_t b;
+            do {
+                b = *p++;
+                x |= uint32_t(b & 0x7f) << deslocamento;
+                deslocamento += 7;
+            } while (b & 0x80);
+            return x;
+        }
+
+    public:
+        using value_type = Edge;
+        using difference_type = std::ptrdiff_t;
+
+        Cursor() = default;
+        // Primeiro destino em zigzag relativo a v; os demais, diferença para o anterior
+        Cursor(const uint8_t* p, const W* peso, int v, int grau) : p(p), peso(peso), v(v), restantes(grau) {
+            if (restantes > 0) {
+                uint32_t z = lerVarint();
+                w = v + (int)((z >> 1) ^ (0u - (z & 1)));
+            }
+        }
+
+        Edge operator*() const { return Edge(v, w, *peso); }
+        Cursor& operator++() {
+            ++peso;
+            if (--restantes > 0) w += (int)lerVarint();
+            return *this;
+        }
+        void operator++(int) { ++*this; }
+        bool operator==(std::default_sentinel_t) const { return restantes <= 0; }
+    };
+
+    class Vizinhos : public std::ranges::view_interface<Vizinhos> {
+        Cursor inicio;
+    public:
+        Vizinhos() = default;
+        explicit Vizinhos(Cursor c) : inicio(c) {}
+        Cursor begin() const { return inicio; }
+        std::default_sentinel_t end() const { return {}; }
+    };
+
+    // Arestas guardadas de v (e.v == v), em ordem crescente de destino
+    Vizinhos neighbors(int v) const {
+        return Vizinhos(Cursor(dados.data() + inicioBytes[v], pesos.data() + inicioArestas[v], v, degree(v)));
+    }
+
+    // Todas as arestas guardadas, vértice a vértice
+    auto edges() const {
+        return std::views::iota(0, numV)
+             | std::views::transform([this](int v) { return neighbors(v); })
+             | std::views::join;
+    }
+};
+
+using CompressedGraph = BasicCompressedGraph<double>;
+
+#endif
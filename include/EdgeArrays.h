@@ -0,0 +1,58 @@
+#ifndef EDGEARRAYS_H
+#define EDGEARRAYS_H
+
+#include <vector>
+#include "WeightedEdge.h"
+#include "WeightedGraph.h"
+#include "CSRGraph.h"
+#include "CompressedGraph.h"
+
+/**
+ * Lista de arestas em estrutura de arrays (SoA): origens, destinos e pesos ficam em
+ * vetores contíguos separados. Varreduras que só comparam pesos ou destinos leem
+ * apenas os bytes de que precisam e podem ser vetorizadas.
+ * A ordem das arestas é a ordem de adjacência do grafo de origem.
+ */
+template <typename W>
+class BasicEdgeArrays {
+public:
+    using Weight = W;
+
+private:
+    int numV;
+    std::vector<int> sources;
+    std::vector<int> targets;
+    std::vector<W> weights;
+
+public:
+    explicit BasicEdgeArrays(int V = 0) : numV(V) {}
+    explicit BasicEdgeArrays(const BasicWeightedGraph<W>& grafo);
+    explicit BasicEdgeArrays(const BasicCSRGraph<W>& grafo);
+    explicit BasicEdgeArrays(const BasicCompressedGraph<W>& grafo);
+
+    int V() const { return numV; }
+    int E() const { return (int)targets.size(); }
+
+    void reserve(int m);
+    void push_back(int u, int v, W peso) {
+        sources.push_back(u);
+        targets.push_back(v);
+        weights.push_back(peso);
+    }
+
+    int source(int e) const { return sources[e]; }
+    int target(int e) const { return targets[e]; }
+    W weight(int e) const { return weights[e]; }
+
+    /**
+     * Para cada vértice v, índice da aresta de menor peso que entra em v
+     * (ignorando laços e arestas que entram na raiz), ou -1 se não houver.
+     * Em empates vence a primeira aresta na ordem do array.
+     * Usa AVX2 (gather + compare) quando a CPU suporta; caso contrário, laço escalar.
+     */
+    void cheapestIncoming(int root, std::vector<int>& melhorAresta) const;
+};
+
+using EdgeArrays = BasicEdgeArrays<double>;
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef EDGEINDEX_H
+#define EDGEINDEX_H
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * Tabela hash de endereçamento aberto (sondagem linear) indexada pelo par (v, w).
+ * Guarda, para cada aresta, a sua posição na lista de adjacência de v, de modo que
+ * consultas de pertinência e de peso custem O(1) esperado independente do grau.
+ * A remoção usa deslocamento reverso (backward shift), sem marcadores de lápide.
+ */
+class EdgeIndex {
+private:
+    struct Slot {
+        long long chave;   // -1 indica posição vazia
+        int posicao;
+    };
+
+    std::vector<Slot> tabela;
+    int ocupados;
+
+    static long long codificar(int v, int w);
+    size_t espalhar(long long chave) const;
+    void crescer();
+
+public:
+    EdgeIndex();
+
+    void clear();
+    void reserve(int n);
+    int size() const { return ocupados; }
+    size_t memoryUsage() const { return tabela.capacity() * sizeof(Slot); }
+
+    // Posição da aresta (v, w) na lista de v, ou -1 se ausente
+    int find(int v, int w) const;
+
+    // Insere ou sobrescreve a posição associada a (v, w)
+    void insert(int v, int w, int posicao);
+
+    void erase(int v, int w);
+};
+
+#endif
@@ -0,0 +1,53 @@
+#ifndef EDGELISTREADER_H
+#define EDGELISTREADER_H
+
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <string>
+#include <vector>
+#include "WeightedEdge.h"
+#include "WeightedGraph.h"
+
+enum class EdgeListFormat {
+    AUTO,    // pela extensão: .gr/.dimacs -> DIMACS, .csv -> CSV, demais -> SNAP
+    SNAP,    // "u v [w]" separados por espaço/tab; '#' inicia comentário
+    DIMACS,  // "p sp n m" e arcos "a u v w" com vértices a partir de 1; 'c' é comentário
+    CSV      // "u,v[,w]"; um cabeçalho não numérico na primeira linha é ignorado
+};
+
+/**
+ * Leitor de listas de arestas em texto. O arquivo é mapeado em memória e dividido
+ * em blocos alinhados a fim de linha, um por thread (ver Parallel); cada bloco é
+ * convertido com std::from_chars, sem streams nem locale. Arestas sem peso recebem
+ * peso 1. Linhas malformadas lançam std::runtime_error.
+ */
+class EdgeListReader {
+public:
+    /**
+     * Lê todas as arestas na ordem do arquivo. numVertices recebe n da linha "p" em
+     * DIMACS ou, nos demais formatos, o maior índice encontrado + 1.
+     */
+    template <typename W>
+    static std::vector<BasicWeightedEdge<W>> read(const std::string& caminho, int& numVertices,
+                                                  EdgeListFormat formato = EdgeListFormat::AUTO);
+
+    /**
+     * Leitura em fluxo: percorre o arquivo em janelas de ~bytesPorBloco bytes e entrega
+     * as arestas de cada janela a `consumir`, na ordem do arquivo, sem juntar tudo num
+     * vetor. Devolve numVertices como em read. Para grafos maiores que a memória (ver
+     * BasicCompressedGraph::fromEdgeList).
+     */
+    template <typename W>
+    static int forEachChunk(const std::string& caminho,
+                            const std::function<void(std::span<const BasicWeightedEdge<W>>)>& consumir,
+                            EdgeListFormat formato = EdgeListFormat::AUTO, size_t bytesPorBloco = 64 << 20);
+
+    // Lê o arquivo e monta o grafo com a inserção em lote (insertEdges)
+    template <typename W>
+    static BasicWeightedGraph<W> load(const std::string& caminho, bool directed,
+                                      EdgeListFormat formato = EdgeListFormat::AUTO,
+                                      DuplicatePolicy politica = DuplicatePolicy::KEEP_FIRST);
+};
+
+#endif
@@ -0,0 +1,171 @@
+#ifndef EDGESORT_H
+#define EDGESORT_H
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <type_traits>
+#include <vector>
+#include "WeightedEdge.h"
+
+// Como EdgeSort::byWeight ordena; AUTO escolhe pela sondagem da faixa de pesos
+enum class WeightSort {
+    AUTO,
+    COMPARISON,  // std::stable_sort (listas pequenas)
+    COUNTING,    // pesos inteiros numa faixa pequena: O(E + faixa)
+    RADIX        // LSD em bytes da chave inteira do peso: O(E) por byte distinto
+};
+
+/**
+ * Ordenação de arestas por peso sem comparações quando possível. Os pesos vêm de
+ * faixas limitadas (distâncias de cor, pesos inteiros de arquivo), então uma passada
+ * de sondagem (mínimo, máximo, todos inteiros?) decide:
+ *  - COUNTING se todos os pesos são inteiros (mesmo em float/double) e a faixa é
+ *    pequena perto de E;
+ *  - RADIX caso contrário, sobre o padrão de bits IEEE-754 transformado para ordenar
+ *    como inteiro sem sinal (bytes iguais em todas as chaves pulam a passada);
+ *  - COMPARISON abaixo de LIMITE_PEQUENO arestas.
+ * COUNTING forçado sobre pesos não inteiros ou numa faixa grande demais (acima de
+ * LIMITE_CONTAGEM) cai para RADIX; o método devolvido é o que de fato ordenou.
+ * Todos os métodos são estáveis: empates saem na ordem da entrada, de modo que o
+ * Kruskal percorre as arestas por (peso, posição), uma ordem total.
+ */
+class EdgeSort {
+public:
+    static constexpr size_t LIMITE_PEQUENO = 256;
+    static constexpr long long LIMITE_CONTAGEM = 1 << 20;
+
+    template <typename W>
+    static WeightSort choose(std::span<const BasicWeightedEdge<W>> arestas) {
+        if (arestas.size() < LIMITE_PEQUENO) return WeightSort::COMPARISON;
+        Sondagem s = sondar(arestas);
+        if (s.inteiros && s.faixa <= std::min<long long>(LIMITE_CONTAGEM, 4 * (long long)arestas.size()))
+            return WeightSort::COUNTING;
+        return WeightSort::RADIX;
+    }
+
+    // Ordena por peso crescente; devolve o método usado
+    template <typename W>
+    static WeightSort byWeight(std::span<BasicWeightedEdge<W>> arestas, WeightSort metodo = WeightSort::AUTO) {
+        if (metodo == WeightSort::AUTO) metodo = choose(std::span<const BasicWeightedEdge<W>>(arestas));
+        switch (metodo) {
+            case WeightSort::COUNTING:
+                if (porContagem(arestas)) break;
+                metodo = WeightSort::RADIX;
+                [[fallthrough]];
+            case WeightSort::RADIX: porRadix(arestas); break;
+            default:
+                std::stable_sort(arestas.begin(), arestas.end(), [](const BasicWeightedEdge<W>& a, const BasicWeightedEdge<W>& b) {
+                    return a.weight < b.weight;
+                });
+        }
+        return metodo;
+    }
+
+private:
+    struct Sondagem {
+        bool inteiros = true;
+        long long minimo = 0;
+        long long faixa = 0;
+    };
+
+    template <typename W>
+    static Sondagem sondar(std::span<const BasicWeightedEdge<W>> arestas) {
+        Sondagem s;
+        if (arestas.empty()) return s;
+        W menor = arestas[0].weight, maior = arestas[0].weight;
+        for (const auto& a : arestas) {
+            menor = std::min(menor, a.weight);
+            maior = std::max(maior, a.weight);
+            if constexpr (std::is_floating_point_v<W>) {
+                if (s.inteiros && a.weight != std::floor(a.weight)) s.inteiros = false;
+            }
+        }
+        // Fora de [-2^62, 2^62] a conversão para long long não é segura
+        if constexpr (std::is_floating_point_v<W>) {
+            if (!(menor >= W(-4.6e18) && maior <= W(4.6e18))) s.inteiros = false;
+        }
+        if (s.inteiros) {
+            s.minimo = (long long)menor;
+            s.faixa = (long long)maior - s.minimo;
+        }
+        return s;
+    }
+
+    // false (sem mexer nas arestas) se os pesos não são inteiros numa faixa contável
+    template <typename W>
+    static bool porContagem(std::span<BasicWeightedEdge<W>> arestas) {
+        Sondagem s = sondar(std::span<const BasicWeightedEdge<W>>(arestas));
+        if (!s.inteiros || s.faixa > LIMITE_CONTAGEM) return false;
+        std::vector<int> inicio(s.faixa + 2, 0);
+        for (const auto& a : arestas) inicio[(long long)a.weight - s.minimo + 1]++;
+        for (long long k = 0; k <= s.faixa; ++k) inicio[k + 1] += inicio[k];
+
+        std::vector<BasicWeightedEdge<W>> saida(arestas.size());
+        for (const auto& a : arestas) saida[inicio[(long long)a.weight - s.minimo]++] = a;
+        std::copy(saida.begin(), saida.end(), arestas.begin());
+        return true;
+    }
+
+    // Chave inteira sem sinal com a mesma ordem do peso
+    template <typename W>
+    using Chave = std::conditional_t<sizeof(W) == 8, uint64_t, uint32_t>;
+
+    template <typename W>
+    static Chave<W> chave(W peso) {
+        using K = Chave<W>;
+        constexpr K sinal = K(1) << (8 * sizeof(K) - 1);
+        if constexpr (std::is_floating_point_v<W>) {
+            if (peso == W(0)) peso = W(0);   // -0.0 empata com +0.0, como na comparação
+            K bits;
+            std::memcpy(&bits, &peso, sizeof(W));
+            // Negativos: inverte tudo (ordem invertida); positivos: liga o bit de sinal
+            return (bits & sinal) ? ~bits : (bits | sinal);
+        } else if constexpr (std::is_signed_v<W>) {
+            return K(peso) ^ sinal;
+        } else {
+            return K(peso);
+        }
+    }
+
+    template <typename W>
+    static void porRadix(std::span<BasicWeightedEdge<W>> arestas) {
+        constexpr int BYTES = sizeof(Chave<W>);
+        size_t n = arestas.size();
+        if (n == 0) return;
+
+        // Histogramas de todos os bytes numa única passada
+        std::vector<std::array<int, 256>> contagem(BYTES);
+        for (auto& c : contagem) c.fill(0);
+        for (const auto& a : arestas) {
+            Chave<W> k = chave(a.weight);
+            for (int b = 0; b < BYTES; ++b) contagem[b][(k >> (8 * b)) & 0xFF]++;
+        }
+
+        std::vector<BasicWeightedEdge<W>> buffer(n);
+        BasicWeightedEdge<W>* origem = arestas.data();
+        BasicWeightedEdge<W>* destino = buffer.data();
+        for (int b = 0; b < BYTES; ++b) {
+            std::array<int, 256>& c = contagem[b];
+            // Byte igual em todas as chaves: a passada não muda a ordem
+            if (c[(chave(origem[0].weight) >> (8 * b)) & 0xFF] == (int)n) continue;
+
+            int soma = 0;
+            for (int d = 0; d < 256; ++d) {
+                int t = c[d];
+                c[d] = soma;
+                soma += t;
+            }
+            for (size_t i = 0; i < n; ++i) {
+                destino[c[(chave(origem[i].weight) >> (8 * b)) & 0xFF]++] = origem[i];
+            }
+            std::swap(origem, destino);
+        }
+        if (origem != arestas.data()) std::copy(origem, origem + n, arestas.data());
+    }
+};
+
+#endif
@@ -2,28 +2,47 @@
 #define EDMONDS_MST_H
 
 #include "WeightedGraph.h"
+#include "CSRGraph.h"
+#include "EdgeArrays.h"
+#include "SpanningResult.h"
 #include <vector>
 #include <limits>
 
 class EdmondsMST {
 public:
-    static WeightedGraph obterArborescencia(WeightedGraph& grafo, int raiz);
+    // Instanciado para os tipos de peso de FOR_EACH_WEIGHT_TYPE
+    template <typename W>
+    static BasicWeightedGraph<W> obterArborescencia(const BasicWeightedGraph<W>& grafo, int raiz);
+    template <typename W>
+    static BasicWeightedGraph<W> obterArborescencia(const BasicCSRGraph<W>& grafo, int raiz);
+
+    // Mesmo resultado como vetor de pais; success == false se algum vértice não é alcançável
+    template <typename W>
+    static BasicArborescenceResult<W> obterPaisArborescencia(const BasicWeightedGraph<W>& grafo, int raiz);
+    template <typename W>
+    static BasicArborescenceResult<W> obterPaisArborescencia(const BasicCSRGraph<W>& grafo, int raiz);
+    // Grafo comprimido (direcionado): as listas são decodificadas uma vez para o SoA;
+    // o pico de memória inclui essa cópia (o comprimido é só o formato de armazenamento)
+    template <typename W>
+    static BasicArborescenceResult<W> obterPaisArborescencia(const BasicCompressedGraph<W>& grafo, int raiz);
 
 private:
+    template <typename W>
     struct InternalResult {
         bool success;
         std::vector<int> parent;
-        std::vector<double> edge_costs;
-        InternalResult(int n = 0) : success(true), parent(n, -1), edge_costs(n, 0.0) {}
+        std::vector<W> edge_costs;
+        InternalResult(int n = 0) : success(true), parent(n, -1), edge_costs(n, W(0)) {}
     };
 
+    template <typename W>
     struct ContractedEdgeInfo {
         int from_component;
         int to_component;
-        double adjusted_cost;
+        W adjusted_cost;
         int original_source;
         int original_target;
-        double original_cost;
+        W original_cost;
     };
 
     struct CycleDetectionResult {
@@ -31,20 +50,31 @@ private:
         std::vector<std::vector<int>> cycles;
     };
 
+    template <typename W>
     struct DirectedEdgeInternal {
         int u, v;
-        double cost;
-        DirectedEdgeInternal(int _u=0, int _v=0, double _c=0.0) : u(_u), v(_v), cost(_c) {}
+        W cost;
+        DirectedEdgeInternal(int _u=0, int _v=0, W _c=W(0)) : u(_u), v(_v), cost(_c) {}
     };
 
-    static std::vector<DirectedEdgeInternal> find_cheapest_incoming_edges(WeightedGraph& graph, int root);
+    // Varredura completa das arestas (SoA) ou, em WeightedGraph, das listas de entrada por destino
+    template <typename W>
+    static std::vector<DirectedEdgeInternal<W>> find_cheapest_incoming_edges(const BasicEdgeArrays<W>& edges, int root);
+    template <typename W>
+    static std::vector<DirectedEdgeInternal<W>> find_cheapest_incoming_edges(const BasicWeightedGraph<W>& graph, int root);
     
-    static CycleDetectionResult detect_cycles(const std::vector<DirectedEdgeInternal>& cheapest_edges, 
+    template <typename W>
+    static CycleDetectionResult detect_cycles(const std::vector<DirectedEdgeInternal<W>>& cheapest_edges, 
                                               int num_vertices, int root);
     
     static long long encode_edge_key(int from, int to);
 
-    static InternalResult run_chu_liu(WeightedGraph& graph, int root_vertex);
+    // Graph: BasicWeightedGraph<W>, BasicCSRGraph<W> ou BasicCompressedGraph<W> (convertidos para BasicEdgeArrays<W>)
+    template <typename Graph>
+    static InternalResult<typename Graph::Weight> run_chu_liu(const Graph& graph, int root_vertex);
+
+    template <typename W>
+    static BasicArborescenceResult<W> build_result(const InternalResult<W>& internal_res, int num_vertices, int root);
 };
 
 #endif 
\ No newline at end of file
@@ -2,6 +2,9 @@
 #define GABOW_MST_H
 
 #include "WeightedGraph.h"
+#include "CSRGraph.h"
+#include "EdgeArrays.h"
+#include "SpanningResult.h"
 #include <vector>
 
 class GabowMST {
@@ -13,8 +16,28 @@ public:
      * * @param grafo Grafo direcionado ponderado.
      * @param raiz Vértice raiz da arborescência (geralmente 0 para imagens).
      * @return Arborescência resultante como um novo WeightedGraph.
+     * Instanciado para os tipos de peso de FOR_EACH_WEIGHT_TYPE.
      */
-    static WeightedGraph obterArborescencia(WeightedGraph& grafo, int raiz);
+    template <typename W>
+    static BasicWeightedGraph<W> obterArborescencia(const BasicWeightedGraph<W>& grafo, int raiz);
+
+    /**
+     * Mesma execução sobre a fotografia CSR do grafo (percorre arrays contíguos).
+     */
+    template <typename W>
+    static BasicWeightedGraph<W> obterArborescencia(const BasicCSRGraph<W>& grafo, int raiz);
+
+    /**
+     * Mesma arborescência como vetor de pais (BasicArborescenceResult), sem construir
+     * um WeightedGraph. obterArborescencia é o adaptador toWeightedGraph() deste resultado.
+     */
+    template <typename W>
+    static BasicArborescenceResult<W> obterPaisArborescencia(const BasicWeightedGraph<W>& grafo, int raiz);
+    template <typename W>
+    static BasicArborescenceResult<W> obterPaisArborescencia(const BasicCSRGraph<W>& grafo, int raiz);
+    // Comprimido: decodificado inteiro para o SoA (o pico de memória inclui essa cópia)
+    template <typename W>
+    static BasicArborescenceResult<W> obterPaisArborescencia(const BasicCompressedGraph<W>& grafo, int raiz);
 };
 
 #endif // GABOW_MST_H
\ No newline at end of file
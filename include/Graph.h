@@ -1,21 +1,56 @@
 #ifndef GRAPH_H
 #define GRAPH_H
 
+#include <memory_resource>
+#include <ranges>
+#include <span>
 #include <vector>
 #include "Edge.h"
 #include "GraphBase.h"
+#include "GraphStats.h"
 
+/**
+ * Remoção preguiçosa: removeVertex e removeEdge só marcam lápides (vértice removido,
+ * aresta com w = -1) e a iteração as pula. Os rótulos continuam estáveis e V() segue
+ * sendo o limite dos rótulos até compact(), que renumera tudo numa passada linear.
+ * Métodos const não alteram nada e podem rodar em paralelo; mutações (incluindo
+ * compact) exigem acesso exclusivo.
+ */
 class Graph : public GraphBase {
 private:
-    std::vector<std::vector<Edge>> adj;
+    std::pmr::vector<std::pmr::vector<Edge>> adj;
+    std::pmr::vector<char> removido;     // lápide por vértice
+    std::pmr::vector<int> lapides;       // arestas marcadas em adj[v]
+    std::pmr::vector<int> grauEntrada;   // arcos vivos que chegam em v (direcionado)
+    int verticesRemovidos;
+    double limiteCompactacao;
+
+    bool viva(const Edge& e) const { return e.w >= 0 && !removido[e.w]; }
+    // Marca a aresta v -> w; false se não existir
+    bool marcarAresta(int v, int w);
+    // Descarta as lápides de adj[v] (os rótulos não mudam)
+    void limparLista(int v);
 
 public:
-    Graph(int V, bool directed);
+    // Listas alocadas em `recurso` (ex.: arena monotônica); ele deve sobreviver ao grafo
+    Graph(int V, bool directed, std::pmr::memory_resource* recurso = std::pmr::get_default_resource());
     ~Graph();
 
-    // Inserção e remoção de vértices
+    // Inserção e remoção de vértices (remoção em O(grau), sem renumerar)
     void insertVertex();
     void removeVertex(int v);
+    bool isRemoved(int v) const { return removido[v] != 0; }
+    int liveVertices() const { return numV - verticesRemovidos; }
+
+    /**
+     * Descarta vértices removidos e lápides e renumera os vivos em ordem, em O(V + E).
+     * Devolve o mapa antigo -> novo (-1 para os removidos).
+     */
+    std::vector<int> compact();
+
+    // Compacta só se a fração de vértices removidos passar do limite (mapa vazio se não)
+    std::vector<int> compactIfNeeded();
+    void setCompactionThreshold(double fracao) { limiteCompactacao = fracao; }
 
     void insertEdge(int v, int w) override;
     void removeEdge(int v, int w);
@@ -25,6 +60,24 @@ public:
     // Impressão do grafo
     void print() const;
 
+    // Bytes ocupados, incluindo a folga (capacity) dos vetores
+    size_t memoryUsage() const;
+    // Distribuição de graus, laços e paralelas; só arestas vivas (ver GraphStats)
+    GraphStats stats() const;
+
+    // Arestas de saída vivas de v, sem cópia; inválido após qualquer alteração do grafo
+    auto neighbors(int v) const {
+        return std::views::filter(std::span<const Edge>(adj[v]), [this](const Edge& e) { return viva(e); });
+    }
+
+    // Todas as arestas vivas, vértice a vértice (não direcionadas aparecem nos dois sentidos)
+    auto edges() const {
+        return std::views::iota(0, numV)
+             | std::views::filter([this](int v) { return !removido[v]; })
+             | std::views::transform([this](int v) { return neighbors(v); })
+             | std::views::join;
+    }
+
     class AdjIterator {
         const Graph& G;
         int v, index;
@@ -32,7 +85,7 @@ public:
         AdjIterator(const Graph& G, int v);
         Edge begin();
         Edge next();
-        bool end();
+        bool end() const;
     };
 };
 
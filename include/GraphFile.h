@@ -0,0 +1,47 @@
+#ifndef GRAPHFILE_H
+#define GRAPHFILE_H
+
+#include <cstdint>
+#include <string>
+#include "WeightedGraph.h"
+#include "CSRGraph.h"
+
+/**
+ * Formato binário de grafos (little-endian, versionado), pensado para ser mapeado
+ * em memória e usado sem nenhuma conversão:
+ *
+ *   [0, 64)   cabeçalho: magic "GRAFOCSR", versão, tipo do peso, flags
+ *             (bit 0 = direcionado), V, E e checksum dos três arrays
+ *   offsets   (V + 1) x int32
+ *   targets   E x int32
+ *   weights   E x W
+ *
+ * Cada array começa num múltiplo de 8 bytes. O checksum é um hash de 64 bits
+ * palavra a palavra sobre os bytes dos três arrays, na ordem acima.
+ * Erros de E/S ou de formato lançam std::runtime_error.
+ */
+class GraphFile {
+public:
+    static constexpr uint32_t VERSAO = 1;
+
+    template <typename W>
+    static void write(const std::string& caminho, const BasicCSRGraph<W>& grafo);
+    template <typename W>
+    static void write(const std::string& caminho, const BasicWeightedGraph<W>& grafo);
+
+    /**
+     * Mapeia o arquivo (mmap, somente leitura) e devolve uma fotografia CSR que aponta
+     * direto para as páginas mapeadas: nada é lido nem copiado até o primeiro acesso,
+     * e processos que mapeiam o mesmo arquivo compartilham o page cache.
+     * O mapeamento vive enquanto existir alguma cópia da fotografia.
+     * offsets[0] == 0 e offsets[V] == E são sempre conferidos (O(1)); verificarChecksum
+     * percorre o arquivo inteiro (offsets monótonos, alvos em [0, V) e checksum) e, por
+     * isso, é opcional. Sem ele um arquivo corrompido leva os solvers a ler fora dos
+     * arrays: arquivos de origem não confiável devem ser mapeados com true.
+     * Arquivo inconsistente lança std::runtime_error.
+     */
+    template <typename W>
+    static BasicCSRGraph<W> map(const std::string& caminho, bool verificarChecksum = false);
+};
+
+#endif
@@ -0,0 +1,114 @@
+#ifndef GRAPHSTATS_H
+#define GRAPHSTATS_H
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <limits>
+#include <vector>
+#include "Parallel.h"
+
+/**
+ * Forma de um grafo, para dimensionar máquinas e flagrar entradas patológicas:
+ * distribuição do grau (de saída; em não-direcionados, o grau), laços, arestas
+ * paralelas (repetições de um mesmo destino numa lista) e faixa de pesos.
+ * Os contadores seguem o armazenamento de cada classe (p.ex. no WeightedGraph
+ * não-direcionado cada aresta aparece nas duas listas).
+ */
+struct GraphStats {
+    int numVertices = 0;
+    long long numEdges = 0;          // E() do grafo
+    bool directed = false;
+    size_t memoryBytes = 0;          // memoryUsage() do grafo
+
+    int minDegree = 0;
+    int maxDegree = 0;
+    double meanDegree = 0;
+    int p50Degree = 0, p90Degree = 0, p99Degree = 0;
+    int isolatedVertices = 0;
+
+    long long selfLoops = 0;
+    long long parallelEdges = 0;     // entradas além da primeira para o mesmo (v, w)
+
+    bool weighted = false;
+    double minWeight = 0;
+    double maxWeight = 0;
+
+    void print(std::ostream& out = std::cout) const;
+
+    /**
+     * Percorre os vértices em paralelo (ver Parallel). vizinhos(v, visitar) deve
+     * chamar visitar(w, peso) para cada aresta guardada de v.
+     */
+    template <typename Vizinhos>
+    static GraphStats compute(int V, long long E, bool directed, bool weighted, Vizinhos vizinhos) {
+        GraphStats s;
+        s.numVertices = V;
+        s.numEdges = E;
+        s.directed = directed;
+        s.weighted = weighted;
+        if (V == 0) return s;
+
+        struct Parcial {
+            long long soma = 0, lacos = 0, paralelas = 0;
+            int isolados = 0;
+            double minPeso = std::numeric_limits<double>::infinity();
+            double maxPeso = -std::numeric_limits<double>::infinity();
+        };
+        // Um Parcial por thread: forRange recebe a mesma contagem usada aqui
+        int threads = Parallel::numThreads();
+        std::vector<Parcial> parciais(threads);
+        std::vector<int> grau(V);
+
+        Parallel::forRange(0, V, [&](long long a, long long b, int t) {
+            Parcial& p = parciais[t];
+            std::vector<int> destinos;
+            for (long long v = a; v < b; ++v) {
+                destinos.clear();
+                vizinhos((int)v, [&](int w, double peso) {
+                    destinos.push_back(w);
+                    if (w == v) p.lacos++;
+                    p.minPeso = std::min(p.minPeso, peso);
+                    p.maxPeso = std::max(p.maxPeso, peso);
+                });
+                grau[v] = (int)destinos.size();
+                p.soma += grau[v];
+                if (grau[v] == 0) p.isolados++;
+                std::sort(destinos.begin(), destinos.end());
+                for (size_t i = 1; i < destinos.size(); ++i) {
+                    if (destinos[i] == destinos[i - 1]) p.paralelas++;
+                }
+            }
+        }, 1 << 12, threads);
+
+        long long soma = 0;
+        s.minWeight = std::numeric_limits<double>::infinity();
+        s.maxWeight = -std::numeric_limits<double>::infinity();
+        for (const Parcial& p : parciais) {
+            soma += p.soma;
+            s.selfLoops += p.lacos;
+            s.parallelEdges += p.paralelas;
+            s.isolatedVertices += p.isolados;
+            s.minWeight = std::min(s.minWeight, p.minPeso);
+            s.maxWeight = std::max(s.maxWeight, p.maxPeso);
+        }
+        if (soma == 0) s.minWeight = s.maxWeight = 0;
+        s.meanDegree = (double)soma / V;
+
+        // Percentis por seleção (nth_element), sem ordenar o vetor inteiro
+        auto percentil = [&](double q) {
+            auto alvo = grau.begin() + (size_t)(q * (V - 1));
+            std::nth_element(grau.begin(), alvo, grau.end());
+            return *alvo;
+        };
+        s.p50Degree = percentil(0.50);
+        s.p90Degree = percentil(0.90);
+        s.p99Degree = percentil(0.99);
+        auto [menor, maior] = std::minmax_element(grau.begin(), grau.end());
+        s.minDegree = *menor;
+        s.maxDegree = *maior;
+        return s;
+    }
+};
+
+#endif
@@ -2,9 +2,13 @@
 #define IMAGE_SEGMENTATION_H
 
 #include <string>
+#include "VertexOrdering.h"
 
 enum class Strategy {
     KRUSKAL_MST,
+    BORUVKA_MST,    // mesma floresta do Kruskal, rodadas em paralelo
+    PRIM_MST,       // mesma floresta do Kruskal, sem ordenar as arestas (grafos densos)
+    AUTO_MST,       // Prim, Kruskal ou Borůvka conforme V, E e threads (StrategyRunner::choose)
     EDMONDS_MSA,
     TARJAN_MSA,
     GABOW_MSA
@@ -13,6 +17,7 @@ enum class Strategy {
 struct PreprocessingOptions {
     bool enableBlur = true;     
     double minSuperpixelSize = 15.0; 
+    Ordering ordering = Ordering::ORIGINAL; // renumeração dos superpixels antes do algoritmo
 };
 
 class ImageSegmentation {
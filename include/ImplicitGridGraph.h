@@ -0,0 +1,129 @@
+#ifndef IMPLICITGRIDGRAPH_H
+#define IMPLICITGRIDGRAPH_H
+
+#include <array>
+#include <cmath>
+#include <cstdlib>
+#include <optional>
+#include <ranges>
+#include "WeightedEdge.h"
+
+// Distância de cor "redmean": aproximação perceptual barata da diferença entre duas cores RGB
+inline double redmeanDistance(long r1, long g1, long b1, long r2, long g2, long b2) {
+    long rmean = (r1 + r2) / 2;
+    long r = r1 - r2;
+    long g = g1 - g2;
+    long b = b1 - b2;
+    return std::sqrt((((512 + rmean) * r * r) >> 8) + 4 * g * g + (((767 - rmean) * b * b) >> 8));
+}
+
+// Functor de peso padrão: distância redmean entre dois pixels de um buffer intercalado (RGB/RGBA)
+struct RedmeanPixelWeight {
+    const unsigned char* img;
+    int canais;
+
+    RedmeanPixelWeight(const unsigned char* img, int canais) : img(img), canais(canais) {}
+
+    double operator()(int u, int v) const {
+        const unsigned char* a = img + (long long)u * canais;
+        const unsigned char* b = img + (long long)v * canais;
+        return redmeanDistance(a[0], a[1], a[2], b[0], b[1], b[2]);
+    }
+};
+
+/**
+ * Grafo de vizinhança-4 de uma imagem w x h, sem lista de adjacência: o vértice
+ * v = y * w + x tem como vizinhos os pixels à direita, abaixo, à esquerda e acima,
+ * calculados a partir das coordenadas. O peso de (u, v) é calculado sob demanda por
+ * PesoFn (u, v) -> W, que em geral lê o buffer de pixels. A memória do grafo é O(1).
+ * Oferece a mesma interface de adjacência de WeightedGraph (V, E, degree, neighbors,
+ * edges, hasEdge, getWeight); as arestas de neighbors(v) são devolvidas por valor.
+ */
+template <typename W, typename PesoFn>
+class BasicImplicitGridGraph {
+public:
+    using Weight = W;
+    using Edge = BasicWeightedEdge<W>;
+
+    // Até quatro arestas montadas na pilha; percorrida como qualquer range
+    class Vizinhanca {
+        std::array<Edge, 4> arestas;
+        int n = 0;
+    public:
+        void push_back(const Edge& e) { arestas[n++] = e; }
+        const Edge* begin() const { return arestas.data(); }
+        const Edge* end() const { return arestas.data() + n; }
+        int size() const { return n; }
+    };
+
+private:
+    int largura;
+    int altura;
+    bool directed;
+    PesoFn peso;
+
+public:
+    BasicImplicitGridGraph(int largura, int altura, PesoFn peso, bool directed = false)
+        : largura(largura), altura(altura), directed(directed), peso(peso) {}
+
+    int width() const { return largura; }
+    int height() const { return altura; }
+    int V() const { return largura * altura; }
+    bool isDirected() const { return directed; }
+
+    // Arestas armazenadas à maneira de WeightedGraph: não direcionadas contam nos dois sentidos
+    int E() const {
+        if (largura == 0 || altura == 0) return 0;
+        int pares = (largura - 1) * altura + largura * (altura - 1);
+        return 2 * pares;
+    }
+
+    int degree(int v) const {
+        int x = v % largura, y = v / largura;
+        return (x + 1 < largura) + (y + 1 < altura) + (x > 0) + (y > 0);
+    }
+
+    bool hasEdge(int v, int w) const {
+        int xv = v % largura, yv = v / largura;
+        int xw = w % largura, yw = w / largura;
+        return std::abs(xv - xw) + std::abs(yv - yw) == 1;
+    }
+
+    // Vazio se v e w não são vizinhos, como em WeightedGraph
+    std::optional<W> getWeight(int v, int w) const {
+        if (!hasEdge(v, w)) return std::nullopt;
+        return W(peso(v, w));
+    }
+
+    // Direita, abaixo, esquerda, acima
+    Vizinhanca neighbors(int v) const {
+        Vizinhanca viz;
+        int x = v % largura, y = v / largura;
+        if (x + 1 < largura) viz.push_back(Edge(v, v + 1, W(peso(v, v + 1))));
+        if (y + 1 < altura) viz.push_back(Edge(v, v + largura, W(peso(v, v + largura))));
+        if (x > 0) viz.push_back(Edge(v, v - 1, W(peso(v, v - 1))));
+        if (y > 0) viz.push_back(Edge(v, v - largura, W(peso(v, v - largura))));
+        return viz;
+    }
+
+    // Só direita e abaixo: cada par de vizinhos aparece uma única vez (v < w)
+    Vizinhanca forwardNeighbors(int v) const {
+        Vizinhanca viz;
+        int x = v % largura, y = v / largura;
+        if (x + 1 < largura) viz.push_back(Edge(v, v + 1, W(peso(v, v + 1))));
+        if (y + 1 < altura) viz.push_back(Edge(v, v + largura, W(peso(v, v + largura))));
+        return viz;
+    }
+
+    // Todas as arestas, vértice a vértice, na ordem de neighbors()
+    auto edges() const {
+        return std::views::iota(0, V())
+             | std::views::transform([this](int v) { return neighbors(v); })
+             | std::views::join;
+    }
+};
+
+template <typename PesoFn>
+using ImplicitGridGraph = BasicImplicitGridGraph<double, PesoFn>;
+
+#endif
@@ -2,6 +2,11 @@
 #define KRUSKAL_MST_H
 
 #include "WeightedGraph.h"
+#include "CSRGraph.h"
+#include "UndirectedGraph.h"
+#include "CompressedGraph.h"
+#include "SpanningResult.h"
+#include "ImplicitGridGraph.h"
 #include <vector>
 
 class KruskalMST {
@@ -10,8 +15,92 @@ public:
      * Executa o algoritmo de Kruskal para encontrar a Árvore Geradora Mínima (MST).
      * @param grafoEntrada O grafo ponderado de origem (deve ser não-direcionado para MST clássica).
      * @return Um novo WeightedGraph contendo apenas as arestas da MST.
+     * Instanciado para os tipos de peso de FOR_EACH_WEIGHT_TYPE.
      */
-    static WeightedGraph obterArvoreGeradoraMinima(WeightedGraph& grafoEntrada);
+    template <typename W>
+    static BasicWeightedGraph<W> obterArvoreGeradoraMinima(const BasicWeightedGraph<W>& grafoEntrada);
+
+    /**
+     * Mesma execução sobre a fotografia CSR do grafo (percorre arrays contíguos).
+     */
+    template <typename W>
+    static BasicWeightedGraph<W> obterArvoreGeradoraMinima(const BasicCSRGraph<W>& grafoEntrada);
+
+    /**
+     * Mesma árvore (ou floresta, se o grafo for desconexo) como vetor de pais,
+     * sem construir um WeightedGraph. obterArvoreGeradoraMinima é o adaptador
+     * toWeightedGraph() deste resultado.
+     */
+    template <typename W>
+    static BasicSpanningForestResult<W> obterFlorestaGeradora(const BasicWeightedGraph<W>& grafoEntrada);
+    template <typename W>
+    static BasicSpanningForestResult<W> obterFlorestaGeradora(const BasicCSRGraph<W>& grafoEntrada);
+
+    // UndirectedGraph (const): filtra e ordena uma cópia do array de arestas
+    template <typename W>
+    static BasicSpanningForestResult<W> obterFlorestaGeradora(const BasicUndirectedGraph<W>& grafoEntrada);
+    /**
+     * Sobre o armazenamento único do UndirectedGraph: ordena o array de arestas do
+     * próprio grafo por peso em vez de copiá-lo. Altera o grafo: os índices de aresta
+     * mudam e quem iterar edges() depois vê a ordem por peso.
+     */
+    template <typename W>
+    static BasicSpanningForestResult<W> obterFlorestaGeradoraNoLugar(BasicUndirectedGraph<W>& grafoEntrada);
+
+    /**
+     * Grafo comprimido, sem cópia decodificada: passadas sobre os cursores guardam só as
+     * arestasPorPassada candidatas mais leves ainda entre componentes diferentes, que
+     * são ordenadas e unidas. Memória O(V + arestasPorPassada); em geral poucas
+     * passadas, porque as arestas internas deixam de ser guardadas.
+     */
+    template <typename W>
+    static BasicSpanningForestResult<W> obterFlorestaGeradora(const BasicCompressedGraph<W>& grafoEntrada,
+                                                              size_t arestasPorPassada = 1 << 22);
+
+    /**
+     * Floresta geradora de uma grade implícita (imagem em resolução total): só a lista
+     * de arestas candidatas é materializada, com pesos calculados uma vez por par de vizinhos.
+     */
+    template <typename W, typename PesoFn>
+    static BasicSpanningForestResult<W> obterFlorestaGeradora(const BasicImplicitGridGraph<W, PesoFn>& grade) {
+        std::vector<BasicWeightedEdge<W>> listaArestas;
+        listaArestas.reserve(grade.E() / 2);
+        for (int u = 0; u < grade.V(); ++u) {
+            for (const auto& aresta : grade.forwardNeighbors(u)) {
+                listaArestas.push_back(aresta);
+            }
+        }
+
+        BasicSpanningForestResult<W> resultado = construirFloresta(grade.V(), listaArestas);
+        resultado.locateEdges(grade);
+        return resultado;
+    }
+
+    /**
+     * Modo limiar: componentes das arestas com peso <= limiar, que são exatamente as
+     * componentes da floresta mínima depois de cortadas as arestas acima do limiar.
+     * Basta unir essas arestas num conjunto disjunto: sem ordenação, sem vetor de pais.
+     */
+    template <typename W>
+    static ComponentLabels obterComponentesAteLimiar(const BasicUndirectedGraph<W>& grafoEntrada, double limiar);
+
+    /**
+     * Vetor de pais de uma floresta dada pelas suas arestas, com cada árvore enraizada
+     * no seu menor vértice (compartilhado com o BoruvkaMST). totalCost fica por conta
+     * de locateEdges.
+     */
+    template <typename W>
+    static BasicSpanningForestResult<W> enraizarFloresta(int numVertices, const std::vector<BasicWeightedEdge<W>>& escolhidas);
+
+    /**
+     * Núcleo comum: Filter-Kruskal sobre as arestas candidatas (u < v). Particiona em
+     * torno de um pivô de peso, resolve a metade leve e filtra da pesada as arestas já
+     * internas antes de descer nela; partição e filtro rodam em paralelo (ver Parallel)
+     * e as faixas pequenas são ordenadas por EdgeSort. Une componentes na ordem
+     * (peso, posição) e enraíza cada árvore no seu menor vértice. Reordena listaArestas.
+     */
+    template <typename W>
+    static BasicSpanningForestResult<W> construirFloresta(int numVertices, std::vector<BasicWeightedEdge<W>>& listaArestas);
 };
 
 #endif // KRUSKAL_MST_H
\ No newline at end of file
@@ -0,0 +1,119 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+/**
+ * Utilitários mínimos de paralelismo com std::thread (sem dependências externas).
+ * O número de threads segue std::thread::hardware_concurrency(), a menos que seja
+ * fixado com setNumThreads(). Intervalos pequenos são executados na thread chamadora.
+ * Dentro de um bloco de forRange, numThreads() vale 1: chamadas aninhadas rodam na
+ * própria thread, em vez de criar até numThreads()² threads.
+ */
+class Parallel {
+private:
+    static inline std::atomic<int> threadsConfiguradas{0};
+    static inline thread_local bool emRegiaoParalela = false;
+
+    // Marca a thread como parte de uma região paralela enquanto o bloco executa
+    struct Regiao {
+        bool anterior;
+        Regiao() : anterior(emRegiaoParalela) { emRegiaoParalela = true; }
+        ~Regiao() { emRegiaoParalela = anterior; }
+    };
+
+public:
+    static int numThreads() {
+        if (emRegiaoParalela) return 1;
+        int n = threadsConfiguradas.load(std::memory_order_relaxed);
+        if (n > 0) return n;
+        int hw = (int)std::thread::hardware_concurrency();
+        return hw > 0 ? hw : 1;
+    }
+
+    // 0 volta ao padrão (hardware_concurrency)
+    static void setNumThreads(int n) { threadsConfiguradas.store(n > 0 ? n : 0, std::memory_order_relaxed); }
+
+    /**
+     * Divide [inicio, fim) em blocos contíguos, um por thread, e chama
+     * fn(blocoInicio, blocoFim, indiceThread). Blocos menores que `grao` não são divididos.
+     */
+    template <typename Fn>
+    static void forRange(long long inicio, long long fim, Fn fn, long long grao = 1 << 14) {
+        forRange(inicio, fim, fn, grao, numThreads());
+    }
+
+    /**
+     * Mesmo, com no máximo `threads` threads: indiceThread fica em [0, threads). Quem
+     * guarda resultados por thread lê numThreads() uma vez e passa o mesmo valor aqui,
+     * já que setNumThreads pode mudar o padrão entre as duas leituras.
+     */
+    template <typename Fn>
+    static void forRange(long long inicio, long long fim, Fn fn, long long grao, int threads) {
+        long long n = fim - inicio;
+        if (n <= 0) return;
+        int t = (int)std::min<long long>(std::max(1, threads), std::max<long long>(1, n / grao));
+        if (t <= 1) {
+            fn(inicio, fim, 0);
+            return;
+        }
+
+        std::vector<std::thread> trabalhadores;
+        trabalhadores.reserve(t - 1);
+        long long passo = (n + t - 1) / t;
+        for (int i = 1; i < t; ++i) {
+            long long a = inicio + i * passo;
+            long long b = std::min(fim, a + passo);
+            if (a >= b) break;
+            trabalhadores.emplace_back([fn, a, b, i]() mutable {
+                Regiao regiao;
+                fn(a, b, i);
+            });
+        }
+        {
+            Regiao regiao;
+            fn(inicio, std::min(fim, inicio + passo), 0);
+        }
+        for (auto& th : trabalhadores) th.join();
+    }
+
+    /**
+     * Ordenação estável: cada thread ordena um bloco e os blocos são intercalados
+     * aos pares (std::inplace_merge também é estável).
+     */
+    template <typename It, typename Cmp>
+    static void stableSort(It first, It last, Cmp comp, long long grao = 1 << 16) {
+        long long n = std::distance(first, last);
+        int t = (int)std::min<long long>(numThreads(), std::max<long long>(1, n / grao));
+        if (t <= 1) {
+            std::stable_sort(first, last, comp);
+            return;
+        }
+
+        std::vector<It> limites;
+        for (int i = 0; i <= t; ++i) limites.push_back(first + (n * i) / t);
+
+        forRange(0, t, [&](long long a, long long b, int) {
+            for (long long i = a; i < b; ++i) std::stable_sort(limites[i], limites[i + 1], comp);
+        }, 1);
+
+        // Rodadas de intercalação: os blocos dobram de tamanho a cada rodada
+        for (int largura = 1; largura < t; largura *= 2) {
+            int pares = (t + 2 * largura - 1) / (2 * largura);
+            forRange(0, pares, [&](long long a, long long b, int) {
+                for (long long p = a; p < b; ++p) {
+                    int esq = (int)p * 2 * largura;
+                    int meio = std::min(esq + largura, t);
+                    int dir = std::min(esq + 2 * largura, t);
+                    if (meio < dir) std::inplace_merge(limites[esq], limites[meio], limites[dir], comp);
+                }
+            }, 1);
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,40 @@
+#ifndef PRIM_MST_H
+#define PRIM_MST_H
+
+#include "WeightedGraph.h"
+#include "CSRGraph.h"
+#include "UndirectedGraph.h"
+#include "SpanningResult.h"
+#include <vector>
+
+class PrimMST {
+public:
+    /**
+     * Floresta geradora mínima pelo algoritmo de Prim com heap 4-ário indexado por
+     * vértice (diminuição de chave no lugar): nenhuma ordenação das arestas, o que
+     * compensa em grafos quase completos. Cada árvore cresce a partir do seu menor vértice.
+     * Empates são desfeitos por (peso, posição da aresta na entrada), a mesma ordem
+     * total do KruskalMST e do BoruvkaMST: as florestas são idênticas.
+     * Instanciado para os tipos de peso de FOR_EACH_WEIGHT_TYPE.
+     */
+    template <typename W>
+    static BasicSpanningForestResult<W> obterFlorestaGeradora(const BasicWeightedGraph<W>& grafoEntrada);
+    template <typename W>
+    static BasicSpanningForestResult<W> obterFlorestaGeradora(const BasicCSRGraph<W>& grafoEntrada);
+    // Direto sobre o array de arestas e as listas de incidência, sem copiar o grafo
+    template <typename W>
+    static BasicSpanningForestResult<W> obterFlorestaGeradora(const BasicUndirectedGraph<W>& grafoEntrada);
+
+    // Adaptador: a mesma floresta materializada num WeightedGraph
+    template <typename W>
+    static BasicWeightedGraph<W> obterArvoreGeradoraMinima(const BasicWeightedGraph<W>& grafoEntrada);
+
+    /**
+     * Núcleo comum sobre as arestas candidatas (u < v); a posição de cada aresta na
+     * lista desfaz os empates. totalCost fica por conta de locateEdges.
+     */
+    template <typename W>
+    static BasicSpanningForestResult<W> construirFloresta(int numVertices, const std::vector<BasicWeightedEdge<W>>& listaArestas);
+};
+
+#endif // PRIM_MST_H
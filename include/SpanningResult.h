@@ -0,0 +1,83 @@
+#ifndef SPANNINGRESULT_H
+#define SPANNINGRESULT_H
+
+#include <vector>
+#include "WeightedEdge.h"
+#include "WeightedGraph.h"
+#include "CSRGraph.h"
+#include "UndirectedGraph.h"
+#include "CompressedGraph.h"
+
+/**
+ * Resultado compacto de uma árvore/arborescência geradora: um vetor de pais.
+ * A aresta escolhida para v é parent[v] -> v, com peso parentWeight[v] e posição
+ * edgeId[v] na ordem de arestas da entrada (índice na fotografia CSR, que coincide
+ * com a ordem de edges() do WeightedGraph; no UndirectedGraph, o índice no array de
+ * arestas). Raízes e vértices não alcançados têm -1.
+ * São três vetores de tamanho V, sem nenhuma alocação por vértice.
+ * Florestas (Kruskal) são enraizadas no menor vértice de cada componente.
+ */
+template <typename W>
+struct BasicSpanningResult {
+    int root;                       // -1 em florestas não direcionadas
+    bool directed;
+    bool success;                   // false se a arborescência não existe
+    std::vector<int> parent;
+    std::vector<W> parentWeight;
+    std::vector<int> edgeId;
+    AccumWeight<W> totalCost;
+
+    explicit BasicSpanningResult(int V = 0, int root = -1, bool directed = true)
+        : root(root), directed(directed), success(true),
+          parent(V, -1), parentWeight(V, W(0)), edgeId(V, -1), totalCost(0) {}
+
+    int V() const { return (int)parent.size(); }
+
+    // Número de arestas escolhidas (vértices com pai)
+    int numEdges() const;
+
+    // Todo vértice chega à raiz subindo pelos pais (sem vértice órfão nem ciclo de pais)
+    bool reachesRoot() const;
+
+    // Preenche edgeId com uma passada O(E) pela entrada e recalcula totalCost
+    void locateEdges(const BasicWeightedGraph<W>& grafo);
+    void locateEdges(const BasicCSRGraph<W>& grafo);
+    void locateEdges(const BasicUndirectedGraph<W>& grafo);
+    void locateEdges(const BasicCompressedGraph<W>& grafo);
+
+    // Qualquer outro grafo com edges() (p.ex. BasicImplicitGridGraph)
+    template <typename Grafo>
+    void locateEdges(const Grafo& grafo) {
+        totalCost = 0;
+        int id = 0;
+        for (const auto& e : grafo.edges()) {
+            if (parent[e.w] == e.v && edgeId[e.w] == -1) {
+                edgeId[e.w] = id;
+                totalCost += parentWeight[e.w];
+            }
+            id++;
+        }
+    }
+
+    // Adaptador de compatibilidade: materializa as arestas escolhidas num WeightedGraph
+    BasicWeightedGraph<W> toWeightedGraph() const;
+};
+
+template <typename W>
+using BasicArborescenceResult = BasicSpanningResult<W>;
+template <typename W>
+using BasicSpanningForestResult = BasicSpanningResult<W>;
+
+using ArborescenceResult = BasicArborescenceResult<double>;
+using SpanningForestResult = BasicSpanningForestResult<double>;
+
+/**
+ * Partição dos vértices em componentes: label[v] em [0, count), numerados na ordem
+ * do menor vértice de cada componente.
+ */
+struct ComponentLabels {
+    std::vector<int> label;
+    int count = 0;
+};
+
+#endif
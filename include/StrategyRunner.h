@@ -0,0 +1,73 @@
+#ifndef STRATEGY_RUNNER_H
+#define STRATEGY_RUNNER_H
+
+#include <span>
+#include <vector>
+#include "ImageSegmentation.h"
+#include "WeightedGraph.h"
+#include "UndirectedGraph.h"
+#include "SpanningResult.h"
+
+// Uma estratégia avaliada pelo StrategyRunner
+template <typename W>
+struct BasicStrategyRun {
+    Strategy strategy;
+    Strategy motor;         // estratégia executada de fato (difere de strategy só em AUTO_MST)
+    BasicSpanningResult<W> resultado;
+    double segundos = 0;    // tempo de parede da estratégia
+};
+
+class StrategyRunner {
+public:
+    static const char* name(Strategy estrategia);
+
+    /**
+     * Motor de AUTO_MST para V vértices e E arestas não-direcionadas: Borůvka quando há
+     * mais de uma thread e arestas suficientes para dividir as rodadas; senão Prim se o
+     * grafo tem ao menos DENSIDADE_PRIM das arestas do grafo completo (o Filter-Kruskal
+     * já descarta sem ordenar a maior parte das arestas pesadas, então o heap só compensa
+     * perto do completo); senão Kruskal. As três dão a mesma floresta.
+     */
+    static constexpr long long ARESTAS_PARALELO = 1 << 16;
+    static constexpr double DENSIDADE_PRIM = 0.5;
+    static Strategy choose(long long numVertices, long long numArestas, int threads);
+    static Strategy choose(long long numVertices, long long numArestas);
+
+    // Estratégia que run executa: AUTO_MST vira o motor de choose para o tamanho do
+    // grafo (arestas contadas uma vez); as demais ficam como estão
+    template <typename W>
+    static Strategy resolve(const BasicWeightedGraph<W>& grafo, Strategy estrategia);
+    template <typename W>
+    static Strategy resolve(const BasicUndirectedGraph<W>& grafo, Strategy estrategia);
+
+    /**
+     * Executa uma estratégia sobre o grafo (AUTO_MST é resolvida por resolve). Num grafo
+     * direcionado, Kruskal, Borůvka e Prim tratam cada arco como aresta não-direcionada;
+     * como a floresta não corresponde a arcos da entrada, edgeId fica -1 e totalCost é
+     * a soma de parentWeight.
+     * Instanciado para os tipos de peso de FOR_EACH_WEIGHT_TYPE.
+     */
+    template <typename W>
+    static BasicSpanningResult<W> run(const BasicWeightedGraph<W>& grafo, Strategy estrategia, int raiz = 0);
+
+    // Estratégias de MST sobre o armazenamento único; as de arborescência lançam
+    // std::invalid_argument (o grafo não tem direção)
+    template <typename W>
+    static BasicSpanningResult<W> run(const BasicUndirectedGraph<W>& grafo, Strategy estrategia);
+
+    /**
+     * Avalia várias estratégias ao mesmo tempo sobre um único grafo compartilhado,
+     * distribuídas entre até Parallel::numThreads() threads. O grafo não é copiado:
+     * os algoritmos só usam a API const, segura para leitores concorrentes.
+     * Cada estratégia roda sequencialmente na sua thread (forRange aninhado não cria
+     * threads), e AUTO_MST escolhe o motor como se houvesse uma só.
+     * Os resultados seguem a ordem de `estrategias`; se alguma estratégia lançar uma
+     * exceção, ela é relançada depois que todas as threads terminam.
+     */
+    template <typename W>
+    static std::vector<BasicStrategyRun<W>> runConcurrently(const BasicWeightedGraph<W>& grafo,
+                                                            std::span<const Strategy> estrategias,
+                                                            int raiz = 0);
+};
+
+#endif
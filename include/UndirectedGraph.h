@@ -0,0 +1,94 @@
+#ifndef UNDIRECTEDGRAPH_H
+#define UNDIRECTEDGRAPH_H
+
+#include <memory_resource>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <vector>
+#include "WeightedEdge.h"
+#include "GraphBase.h"
+#include "WeightedGraph.h"
+#include "GraphStats.h"
+
+/**
+ * Grafo ponderado não-direcionado com armazenamento único: cada aresta existe uma só
+ * vez num array global (normalizada com v <= w) e cada vértice guarda apenas os
+ * índices das arestas incidentes. E() conta cada aresta uma vez.
+ * Atualizar um peso toca uma única posição e o Kruskal ordena o próprio array
+ * (a sobrecarga const ordena uma cópia, para leitores concorrentes).
+ */
+template <typename W>
+class BasicUndirectedGraph : public GraphBase {
+public:
+    using Weight = W;
+    using Edge = BasicWeightedEdge<W>;
+
+private:
+    std::pmr::vector<Edge> arestas;
+    // incidencia[v]: índices em `arestas` (laços aparecem uma vez)
+    std::pmr::vector<std::pmr::vector<int>> incidencia;
+
+    // Index of the edge {v, w}, or -1
+    int findEdge(int v, int w) const;
+    void appendEdge(int v, int w, W weight);
+    void rebuildIncidence();
+
+public:
+    // O recurso deve sobreviver ao grafo; cópias voltam ao recurso padrão
+    explicit BasicUndirectedGraph(int V, std::pmr::memory_resource* recurso = std::pmr::get_default_resource());
+
+    // Converte um WeightedGraph não-direcionado (as duas cópias de cada aresta viram uma)
+    explicit BasicUndirectedGraph(const BasicWeightedGraph<W>& grafo);
+
+    // Insertion (no-op if {v, w} already exists)
+    void insertEdge(int v, int w, W weight);
+    void insertEdge(int v, int w) override { insertEdge(v, w, W(1)); }
+
+    // Bulk insertion: (v, w) and (w, v) are the same edge; duplicates merged by policy
+    void insertEdges(std::span<const Edge> edges, DuplicatePolicy policy = DuplicatePolicy::KEEP_FIRST);
+
+    // Removal: the last edge takes the removed edge's index
+    void removeEdge(int v, int w);
+
+    // Update weight (single location)
+    bool updateWeight(int v, int w, W newWeight);
+
+    // Verification
+    bool hasEdge(int v, int w) const override;
+
+    // Get weight of an edge (empty if absent, as in WeightedGraph)
+    std::optional<W> getWeight(int v, int w) const;
+
+    int degree(int v) const { return (int)incidencia[v].size(); }
+
+    // Bytes ocupados, incluindo a folga (capacity) dos vetores
+    size_t memoryUsage() const;
+    // Distribuição de graus, laços, paralelas e pesos (ver GraphStats)
+    GraphStats stats() const;
+
+    // Global edge array, each edge once with v <= w
+    std::span<const Edge> edges() const { return arestas; }
+    const Edge& edge(int id) const { return arestas[id]; }
+
+    // Indices of the edges incident to v
+    std::span<const int> incidentEdges(int v) const { return incidencia[v]; }
+
+    // Endpoint of edge id opposite to v
+    int opposite(int id, int v) const { return arestas[id].v == v ? arestas[id].w : arestas[id].v; }
+
+    // Edges incident to v seen from v (e.v == v), built on the fly from the indices
+    auto neighbors(int v) const {
+        return std::views::transform(incidencia[v], [this, v](int id) {
+            return Edge(v, opposite(id, v), arestas[id].weight);
+        });
+    }
+
+    // Ordena o próprio array de arestas por peso (contagem ou radix, ver EdgeSort) e
+    // refaz a incidência em O(V + E). Os índices de aresta mudam.
+    void sortEdgesByWeight();
+};
+
+using UndirectedGraph = BasicUndirectedGraph<double>;
+
+#endif
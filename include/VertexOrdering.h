@@ -0,0 +1,101 @@
+#ifndef VERTEXORDERING_H
+#define VERTEXORDERING_H
+
+#include <span>
+#include <utility>
+#include <vector>
+#include "WeightedEdge.h"
+#include "WeightedGraph.h"
+#include "SpanningResult.h"
+
+enum class Ordering {
+    ORIGINAL,  // identidade
+    BFS,       // ordem de descoberta de uma busca em largura por componente
+    RCM,       // Cuthill-McKee reverso (BFS partindo do menor grau, vizinhos por grau crescente)
+    DEGREE,    // grau decrescente (vértices mais acessados primeiro)
+    HILBERT    // posição na curva de Hilbert das coordenadas dadas (p.ex. centroides)
+};
+
+/**
+ * Permutação de vértices: toNew(v) é o novo rótulo do vértice original v e
+ * toOld(i) o caminho inverso. Usada para traduzir arestas antes de montar o grafo
+ * e resultados de volta aos rótulos originais.
+ */
+struct VertexPermutation {
+    std::vector<int> novoDe;   // original -> novo
+    std::vector<int> antigoDe; // novo -> original
+
+    int V() const { return (int)novoDe.size(); }
+    int toNew(int v) const { return novoDe[v]; }
+    int toOld(int v) const { return antigoDe[v]; }
+
+    // Reescreve as pontas das arestas com os novos rótulos
+    template <typename W>
+    void relabel(std::span<BasicWeightedEdge<W>> arestas) const {
+        for (auto& a : arestas) {
+            a.v = novoDe[a.v];
+            a.w = novoDe[a.w];
+        }
+    }
+
+    // Resultado calculado sobre o grafo permutado, nos rótulos originais. edgeId volta
+    // a -1 (os índices dependem da ordem das arestas): use locateEdges no grafo original.
+    template <typename W>
+    BasicSpanningResult<W> restore(const BasicSpanningResult<W>& r) const {
+        BasicSpanningResult<W> original(r.V(), r.root == -1 ? -1 : antigoDe[r.root], r.directed);
+        original.success = r.success;
+        original.totalCost = r.totalCost;
+        for (int i = 0; i < r.V(); ++i) {
+            if (r.parent[i] == -1) continue;
+            original.parent[antigoDe[i]] = antigoDe[r.parent[i]];
+            original.parentWeight[antigoDe[i]] = r.parentWeight[i];
+        }
+        return original;
+    }
+};
+
+template <typename W>
+struct BasicReorderedGraph {
+    BasicWeightedGraph<W> grafo;
+    VertexPermutation permutacao;
+};
+
+/**
+ * Renumeração de vértices para localidade de cache: vértices vizinhos recebem rótulos
+ * próximos, de modo que os vetores indexados por vértice (union-find, heaps, pais)
+ * são acessados em regiões contíguas. Em grafos direcionados BFS/RCM seguem arestas
+ * nos dois sentidos.
+ */
+class VertexOrdering {
+public:
+    /**
+     * Calcula a permutação. HILBERT exige uma coordenada (x, y) por vértice e lança
+     * std::invalid_argument sem elas; as demais ignoram `coordenadas`.
+     */
+    template <typename W>
+    static VertexPermutation compute(const BasicWeightedGraph<W>& grafo, Ordering ordem,
+                                     std::span<const std::pair<double, double>> coordenadas = {});
+
+    /**
+     * A mesma permutação direto de uma lista de arestas, sem montar o grafo: arestas
+     * repetidas contam uma vez, como em insertEdges. Só BFS/RCM/DEGREE montam uma
+     * vizinhança compacta (rótulos em CSR, sem pesos).
+     */
+    template <typename W>
+    static VertexPermutation compute(int numVertices, std::span<const BasicWeightedEdge<W>> arestas,
+                                     bool directed, Ordering ordem,
+                                     std::span<const std::pair<double, double>> coordenadas = {});
+
+    // Só a curva de Hilbert: não depende das arestas, serve antes de montar o grafo
+    static VertexPermutation hilbert(std::span<const std::pair<double, double>> coordenadas);
+
+    // Cópia do grafo com os vértices renumerados (listas em ordem de destino)
+    template <typename W>
+    static BasicWeightedGraph<W> apply(const BasicWeightedGraph<W>& grafo, const VertexPermutation& permutacao);
+
+    template <typename W>
+    static BasicReorderedGraph<W> reorderVertices(const BasicWeightedGraph<W>& grafo, Ordering ordem,
+                                                  std::span<const std::pair<double, double>> coordenadas = {});
+};
+
+#endif
@@ -1,13 +1,26 @@
 #ifndef WEIGHTEDEDGE_H
 #define WEIGHTEDEDGE_H
 
+#include <cstdint>
+#include <type_traits>
+
 // Represents a weighted directed edge between two vertices v and w.
-struct WeightedEdge {
+template <typename W>
+struct BasicWeightedEdge {
     int v, w;
-    double weight;
+    W weight;
 
-    WeightedEdge(int v = -1, int w = -1, double weight = 1.0)
+    BasicWeightedEdge(int v = -1, int w = -1, W weight = W(1))
         : v(v), w(w), weight(weight) {}
 };
 
+using WeightedEdge = BasicWeightedEdge<double>;
+
+// Sums and reduced costs: integer weights widen to signed 64 bits
+template <typename W>
+using AccumWeight = std::conditional_t<std::is_integral_v<W>, long long, W>;
+
+// Weight types with explicit instantiations of the graphs and solvers
+#define FOR_EACH_WEIGHT_TYPE(X) X(uint16_t) X(int32_t) X(float) X(double)
+
 #endif
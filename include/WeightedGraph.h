@@ -1,46 +1,196 @@
 #ifndef WEIGHTEDGRAPH_H
 #define WEIGHTEDGRAPH_H
 
+#include <atomic>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <optional>
+#include <ranges>
+#include <span>
 #include <vector>
 #include "WeightedEdge.h"
 #include "GraphBase.h"
+#include "EdgeIndex.h"
+#include "GraphStats.h"
+
+// What to do when a bulk insertion finds the same (v, w) more than once
+enum class DuplicatePolicy {
+    KEEP_MIN,    // keep the smallest weight
+    KEEP_FIRST,  // keep the first occurrence (existing edges win)
+    SUM          // add the weights
+};
+
+// Combina o peso de uma duplicata segundo a política escolhida
+template <typename W>
+inline W combinarPeso(W atual, W novo, DuplicatePolicy politica) {
+    switch (politica) {
+        case DuplicatePolicy::KEEP_MIN: return novo < atual ? novo : atual;
+        case DuplicatePolicy::SUM: return atual + novo;
+        case DuplicatePolicy::KEEP_FIRST: break;
+    }
+    return atual;
+}
+
+/**
+ * Grafo ponderado com listas de adjacência.
+ * Acesso concorrente: qualquer número de threads pode chamar métodos const ao mesmo
+ * tempo (inclusive inEdges(), cuja construção sob demanda é serializada); mutações
+ * exigem acesso exclusivo.
+ * Versões: as listas ficam em blocos de vértices compartilhados por contagem de
+ * referências. snapshot() cria outra versão em O(1) e cada escrita copia apenas o
+ * bloco tocado, de modo que um solver pode ler a versão antiga enquanto outra thread
+ * prepara a próxima (com um recurso de memória thread-safe, como o padrão).
+ */
+template <typename W>
+class BasicWeightedGraph : public GraphBase {
+public:
+    using Weight = W;
+    using Edge = BasicWeightedEdge<W>;
 
-class WeightedGraph : public GraphBase {
 private:
-    std::vector<std::vector<WeightedEdge>> adj;
+    using Lista = std::pmr::vector<Edge>;
+
+    // Vértices por bloco: a unidade de cópia na escrita
+    static constexpr int BITS_BLOCO = 8;
+    static constexpr int TAM_BLOCO = 1 << BITS_BLOCO;
+
+    struct Bloco {
+        std::pmr::vector<Lista> listas;
+        Bloco(int n, std::pmr::memory_resource* recurso) : listas(n, recurso) {}
+        Bloco(const Bloco& outro, std::pmr::memory_resource* recurso) : listas(outro.listas, recurso) {}
+    };
+
+    struct Diretorio {
+        std::pmr::vector<std::shared_ptr<Bloco>> blocos;
+        explicit Diretorio(std::pmr::memory_resource* recurso) : blocos(recurso) {}
+        Diretorio(const Diretorio& outro, std::pmr::memory_resource* recurso) : blocos(outro.blocos, recurso) {}
+    };
+
+    // Blocos, diretório e listas alocados em `recurso` (pmr): com uma arena monotônica,
+    // construir e destruir o grafo custa poucas alocações em vez de uma por vértice
+    std::pmr::memory_resource* recurso;
+    std::shared_ptr<Diretorio> diretorio;
     bool directed;// é direcionado?
 
+    static std::shared_ptr<Diretorio> novoDiretorio(int V, std::pmr::memory_resource* recurso);
+
+    const Lista& lista(int v) const { return diretorio->blocos[v >> BITS_BLOCO]->listas[v & (TAM_BLOCO - 1)]; }
+    // Lista de v para escrita; copia antes o diretório e o bloco se outra versão os compartilha
+    Lista& listaMutavel(int v);
+
+    // Índice hash opcional (v, w) -> posição na lista de v
+    EdgeIndex indice;
+    bool usarIndice;
+
+    // Adjacência transposta (arestas de entrada), construída sob demanda
+    mutable std::pmr::vector<int> inOffsets;
+    mutable std::pmr::vector<Edge> inAdj;
+
+    // Trava da construção sob demanda; cópias começam com a transposta inválida
+    struct EstadoEntrada {
+        std::mutex trava;
+        std::atomic<bool> valido{false};
+        EstadoEntrada() = default;
+        EstadoEntrada(const EstadoEntrada&) {}
+        EstadoEntrada& operator=(const EstadoEntrada&) {
+            valido.store(false, std::memory_order_relaxed);
+            return *this;
+        }
+    };
+    mutable EstadoEntrada entrada;
+    void invalidarEntrada() { entrada.valido.store(false, std::memory_order_relaxed); }
+
+    // Position of (v, w) in v's list, or -1
+    int findEdge(int v, int w) const;
+    void appendEdge(int v, int w, W weight);
+    void eraseEdgeAt(int v, int pos);
+    void buildInEdges() const;
 
 public:
-    WeightedGraph(int V, bool directed = false);
-    ~WeightedGraph();
+    // O recurso deve sobreviver ao grafo; cópias voltam ao recurso padrão
+    BasicWeightedGraph(int V, bool directed = false,
+                       std::pmr::memory_resource* recurso = std::pmr::get_default_resource());
+    ~BasicWeightedGraph();
+
+    // Cópia profunda (nada compartilhado); para uma versão barata use snapshot()
+    BasicWeightedGraph(const BasicWeightedGraph& outro);
+    BasicWeightedGraph& operator=(const BasicWeightedGraph& outro);
+    BasicWeightedGraph(BasicWeightedGraph&&) = default;
+    BasicWeightedGraph& operator=(BasicWeightedGraph&&) = default;
+
+    // Nova versão em O(1) que compartilha todos os blocos (e o recurso) com esta; as
+    // duas podem ser alteradas depois, cada escrita copiando só o bloco tocado.
+    // O índice de arestas não é herdado (enableEdgeIndex() o reconstrói).
+    BasicWeightedGraph snapshot() const;
+
+    // Blocos de adjacência ainda compartilhados com outra versão
+    int sharedBlocks(const BasicWeightedGraph& outra) const;
+    int blockCount() const { return (int)diretorio->blocos.size(); }
 
     // Insertion
-    void insertEdge(int v, int w, double weight);
-    void insertEdge(int v, int w) override { insertEdge(v, w, 1.0); }
+    void insertEdge(int v, int w, W weight);
+    void insertEdge(int v, int w) override { insertEdge(v, w, W(1)); }
+
+    // Bulk insertion: sort-based deduplication, then every list that receives edges is
+    // reserved once to its exact final size. New edges keep the input order, as a
+    // sequence of insertEdge calls would; pairs already present are combined in place.
+    // A vertex outside [0, V) throws std::invalid_argument before the graph changes.
+    void insertEdges(std::span<const Edge> edges, DuplicatePolicy policy = DuplicatePolicy::KEEP_FIRST);
 
     // Removal
     void removeEdge(int v, int w);
 
     // Update weight
-    bool updateWeight(int v, int w, double newWeight);
+    bool updateWeight(int v, int w, W newWeight);
 
     // Verification
     bool hasEdge(int v, int w) const override;
 
-    // Get weight of an edge
-    double getWeight(int v, int w) const;
+    // Get weight of an edge (empty if absent: no sentinel, any W value is a valid weight)
+    std::optional<W> getWeight(int v, int w) const;
+
+    // Optional O(1) expected edge index, kept in sync on insert/remove/update.
+    // Only queries become O(1): removeEdge still costs O(degree), since the edges after
+    // the removed one shift back and are re-indexed.
+    void enableEdgeIndex();
+    void disableEdgeIndex();
+    bool hasEdgeIndex() const { return usarIndice; }
+
+    // Out-degree of v
+    int degree(int v) const;
+
+    // Bytes ocupados, incluindo a folga (capacity) dos vetores
+    size_t memoryUsage() const;
+    // Distribuição de graus, laços, paralelas e pesos (ver GraphStats)
+    GraphStats stats() const;
+
+    // Out-edges of v as a contiguous view (no copies); invalidated by any mutation
+    std::span<const Edge> neighbors(int v) const { return lista(v); }
+
+    // Every stored edge, vertex by vertex (an undirected edge shows up once per endpoint)
+    auto edges() const {
+        return std::views::iota(0, numV)
+             | std::views::transform([this](int v) { return neighbors(v); })
+             | std::views::join;
+    }
+
+    // Incoming edges of v (e.v = source, e.w = v), ordered by source.
+    // Built lazily in O(V + E) on first use and invalidated by any mutation.
+    std::span<const Edge> inEdges(int v) const;
 
     // Iterator
     class AdjIterator {
-        const WeightedGraph& G;
+        const BasicWeightedGraph& G;
         int v, index;
     public:
-        AdjIterator(const WeightedGraph& G, int v);
-        WeightedEdge begin();
-        WeightedEdge next();
-        bool end();
+        AdjIterator(const BasicWeightedGraph& G, int v);
+        Edge begin();
+        Edge next();
+        bool end() const;
     };
 };
 
+using WeightedGraph = BasicWeightedGraph<double>;
+
 #endif
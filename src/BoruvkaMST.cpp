@@ -0,0 +1,164 @@
+#include "BoruvkaMST.h"
+#include "KruskalMST.h"
+#include "Parallel.h"
+#include <atomic>
+#include <numeric>
+#include <vector>
+
+// Conjunto disjunto para uniões concorrentes: a raiz de maior índice é pendurada sob a
+// de menor por CAS (os pais só apontam para índices menores, logo não há ciclos) e a
+// busca comprime o caminho pela metade
+struct ConjuntoDisjuntoConcorrente {
+    std::vector<std::atomic<int>> pai;
+
+    explicit ConjuntoDisjuntoConcorrente(int n) : pai(n) {
+        for (int i = 0; i < n; i++) pai[i].store(i, std::memory_order_relaxed);
+    }
+
+    int buscar(int v) {
+        while (true) {
+            int p = pai[v].load();
+            if (p == v) return v;
+            int avo = pai[p].load();
+            if (avo != p) pai[v].compare_exchange_weak(p, avo);
+            v = avo;
+        }
+    }
+
+    // false se já estavam na mesma componente
+    bool unir(int a, int b) {
+        while (true) {
+            a = buscar(a);
+            b = buscar(b);
+            if (a == b) return false;
+            if (a < b) std::swap(a, b);
+            int esperado = a;
+            if (pai[a].compare_exchange_strong(esperado, b)) return true;
+        }
+    }
+};
+
+template <typename W>
+BasicSpanningForestResult<W> BoruvkaMST::construirFloresta(int numVertices, const std::vector<BasicWeightedEdge<W>>& arestas) {
+    const long long grao = 1 << 14;
+    int numArestas = (int)arestas.size();
+
+    // Ordem total estrita: (peso, posição)
+    auto precede = [&](int a, int b) {
+        return arestas[a].weight < arestas[b].weight || (!(arestas[b].weight < arestas[a].weight) && a < b);
+    };
+    auto propor = [&](std::atomic<int>& alvo, int e) {
+        int atual = alvo.load(std::memory_order_relaxed);
+        while ((atual == -1 || precede(e, atual)) &&
+               !alvo.compare_exchange_weak(atual, e, std::memory_order_relaxed)) {}
+    };
+
+    ConjuntoDisjuntoConcorrente ds(numVertices);
+    std::vector<int> ativas(numArestas);
+    std::iota(ativas.begin(), ativas.end(), 0);
+    std::vector<int> rotulo(numVertices);
+    std::vector<std::atomic<int>> melhor(numVertices);
+    std::vector<char> escolhida(numArestas, 0);
+
+    while (!ativas.empty()) {
+        // Componente atual de cada vértice (as uniões da rodada anterior já terminaram)
+        Parallel::forRange(0, numVertices, [&](long long a, long long b, int) {
+            for (long long v = a; v < b; ++v) {
+                rotulo[v] = ds.buscar((int)v);
+                melhor[v].store(-1, std::memory_order_relaxed);
+            }
+        }, grao);
+
+        // Aresta de saída mais leve de cada componente
+        Parallel::forRange(0, (long long)ativas.size(), [&](long long a, long long b, int) {
+            for (long long i = a; i < b; ++i) {
+                int e = ativas[i];
+                int cu = rotulo[arestas[e].v];
+                int cv = rotulo[arestas[e].w];
+                if (cu == cv) continue;
+                propor(melhor[cu], e);
+                propor(melhor[cv], e);
+            }
+        }, grao);
+
+        // Contração: as arestas escolhidas formam uma floresta (a ordem é total), então
+        // cada uma une duas componentes distintas; a escolhida pelas duas pontas une uma vez
+        Parallel::forRange(0, numVertices, [&](long long a, long long b, int) {
+            for (long long c = a; c < b; ++c) {
+                int e = melhor[c].load(std::memory_order_relaxed);
+                if (e != -1 && ds.unir(arestas[e].v, arestas[e].w)) escolhida[e] = 1;
+            }
+        }, grao);
+
+        // Compactação: só seguem as arestas entre componentes diferentes
+        // Uma leitura de numThreads(): o mesmo valor dimensiona partes e limita o índice t
+        int threads = Parallel::numThreads();
+        std::vector<std::vector<int>> partes(threads);
+        Parallel::forRange(0, (long long)ativas.size(), [&](long long a, long long b, int t) {
+            for (long long i = a; i < b; ++i) {
+                int e = ativas[i];
+                if (ds.buscar(arestas[e].v) != ds.buscar(arestas[e].w)) partes[t].push_back(e);
+            }
+        }, grao, threads);
+        ativas.clear();
+        for (const auto& parte : partes) ativas.insert(ativas.end(), parte.begin(), parte.end());
+    }
+
+    std::vector<BasicWeightedEdge<W>> escolhidas;
+    escolhidas.reserve(numVertices > 0 ? numVertices - 1 : 0);
+    for (int e = 0; e < numArestas; ++e) {
+        if (escolhida[e]) escolhidas.push_back(arestas[e]);
+    }
+    return KruskalMST::enraizarFloresta(numVertices, escolhidas);
+}
+
+template <typename W>
+BasicSpanningForestResult<W> BoruvkaMST::obterFlorestaGeradora(const BasicWeightedGraph<W>& grafoEntrada) {
+    std::vector<BasicWeightedEdge<W>> listaArestas;
+    listaArestas.reserve(grafoEntrada.E());
+    for (const auto& aresta : grafoEntrada.edges()) {
+        if (aresta.v < aresta.w) listaArestas.push_back(aresta);
+    }
+
+    BasicSpanningForestResult<W> resultado = construirFloresta(grafoEntrada.V(), listaArestas);
+    resultado.locateEdges(grafoEntrada);
+    return resultado;
+}
+
+template <typename W>
+BasicSpanningForestResult<W> BoruvkaMST::obterFlorestaGeradora(const BasicCSRGraph<W>& grafoEntrada) {
+    std::vector<BasicWeightedEdge<W>> listaArestas;
+    listaArestas.reserve(grafoEntrada.E() / 2);
+    for (int u = 0; u < grafoEntrada.V(); ++u) {
+        for (int e = grafoEntrada.firstEdge(u); e < grafoEntrada.lastEdge(u); ++e) {
+            int v = grafoEntrada.target(e);
+            if (u < v) listaArestas.push_back(BasicWeightedEdge<W>(u, v, grafoEntrada.weight(e)));
+        }
+    }
+
+    BasicSpanningForestResult<W> resultado = construirFloresta(grafoEntrada.V(), listaArestas);
+    resultado.locateEdges(grafoEntrada);
+    return resultado;
+}
+
+template <typename W>
+BasicSpanningForestResult<W> BoruvkaMST::obterFlorestaGeradora(const BasicUndirectedGraph<W>& grafoEntrada) {
+    std::vector<BasicWeightedEdge<W>> listaArestas(grafoEntrada.edges().begin(), grafoEntrada.edges().end());
+
+    BasicSpanningForestResult<W> resultado = construirFloresta(grafoEntrada.V(), listaArestas);
+    resultado.locateEdges(grafoEntrada);
+    return resultado;
+}
+
+template <typename W>
+BasicWeightedGraph<W> BoruvkaMST::obterArvoreGeradoraMinima(const BasicWeightedGraph<W>& grafoEntrada) {
+    return obterFlorestaGeradora(grafoEntrada).toWeightedGraph();
+}
+
+#define INSTANCIAR_BORUVKA(W) \
+    template BasicSpanningForestResult<W> BoruvkaMST::obterFlorestaGeradora(const BasicWeightedGraph<W>&); \
+    template BasicSpanningForestResult<W> BoruvkaMST::obterFlorestaGeradora(const BasicCSRGraph<W>&); \
+    template BasicSpanningForestResult<W> BoruvkaMST::obterFlorestaGeradora(const BasicUndirectedGraph<W>&); \
+    template BasicWeightedGraph<W> BoruvkaMST::obterArvoreGeradoraMinima(const BasicWeightedGraph<W>&); \
+    template BasicSpanningForestResult<W> BoruvkaMST::construirFloresta(int, const std::vector<BasicWeightedEdge<W>>&);
+FOR_EACH_WEIGHT_TYPE(INSTANCIAR_BORUVKA)
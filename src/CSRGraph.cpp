@@ -0,0 +1,229 @@
+#include "CSRGraph.h"
+#include "Parallel.h"
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+
+// Armazenamento próprio de uma fotografia construída em memória
+template <typename W>
+struct ArraysCSR {
+    std::vector<int> offsets;
+    std::vector<int> targets;
+    std::vector<W> weights;
+};
+
+template <typename W>
+BasicCSRGraph<W>::BasicCSRGraph(const BasicWeightedGraph<W>& grafo)
+    : numV(grafo.V()), numE(0), directed(grafo.isDirected()) {
+    auto arrays = std::make_shared<ArraysCSR<W>>();
+    arrays->offsets.assign(numV + 1, 0);
+
+    // Primeira passada: graus de saída -> offsets (soma de prefixos)
+    for (int v = 0; v < numV; ++v) {
+        arrays->offsets[v + 1] = arrays->offsets[v] + grafo.degree(v);
+    }
+    numE = arrays->offsets[numV];
+    arrays->targets.resize(numE);
+    arrays->weights.resize(numE);
+
+    // Segunda passada: copia destinos e pesos preservando a ordem de adjacência
+    for (int v = 0; v < numV; ++v) {
+        int pos = arrays->offsets[v];
+        for (const Edge& e : grafo.neighbors(v)) {
+            arrays->targets[pos] = e.w;
+            arrays->weights[pos] = e.weight;
+            pos++;
+        }
+    }
+
+    offsets = arrays->offsets.data();
+    targets = arrays->targets.data();
+    weights = arrays->weights.data();
+    dono = std::move(arrays);
+}
+
+template <typename W>
+BasicCSRGraph<W> BasicCSRGraph<W>::fromEdges(int V, std::span<const Edge> arestas, bool directed,
+                                             DuplicatePolicy politica) {
+    if (V < 0) throw std::invalid_argument("CSRGraph: V negativo");
+    struct Entrada {
+        int alvo;
+        W peso;
+    };
+
+    // Blocos fixos e contíguos da entrada, um por thread: a ordem da entrada se preserva.
+    // Cada thread a mais custa um histograma de V posições: t * V fica limitado por m,
+    // senão um grafo esparso com V grande gastaria mais zerando e somando do que distribuindo
+    long long m = (long long)arestas.size();
+    const long long GRAO = 1 << 16;
+    long long arestasPorVertice = V > 0 ? m / V : m;
+    int t = (int)std::min<long long>({(long long)Parallel::numThreads(), std::max<long long>(1, m / GRAO),
+                                      std::max<long long>(1, arestasPorVertice)});
+    std::vector<long long> limites(t + 1);
+    for (int i = 0; i <= t; ++i) limites[i] = m * i / t;
+
+    // 1. Histograma de graus por thread: contagem[i * V + v]. Cada thread também conta
+    // suas entradas e marca vértices fora de [0, V), checados antes de qualquer escrita
+    std::vector<int> contagem((size_t)t * V, 0);
+    std::vector<long long> entradasDaThread(t, 0);
+    std::vector<char> foraDoIntervalo(t, 0);
+    Parallel::forRange(0, t, [&](long long a, long long b, int) {
+        for (long long i = a; i < b; ++i) {
+            int* c = contagem.data() + (size_t)i * V;
+            long long total = 0;
+            for (long long k = limites[i]; k < limites[i + 1]; ++k) {
+                const Edge& e = arestas[k];
+                if (e.v < 0 || e.v >= V || e.w < 0 || e.w >= V) {
+                    foraDoIntervalo[i] = 1;
+                    break;
+                }
+                c[e.v]++;
+                total++;
+                if (!directed && e.v != e.w) {
+                    c[e.w]++;
+                    total++;
+                }
+            }
+            entradasDaThread[i] = total;
+        }
+    }, 1);
+    long long totalEntradas = 0;
+    for (int i = 0; i < t; ++i) {
+        if (foraDoIntervalo[i]) throw std::invalid_argument("CSRGraph: vértice fora de [0, V)");
+        totalEntradas += entradasDaThread[i];
+    }
+    // Sem direção cada aresta ocupa duas entradas: offsets de 32 bits limitam o total
+    if (totalEntradas > INT32_MAX) throw std::invalid_argument("CSRGraph: arestas demais para índices de 32 bits");
+
+    // 2. Soma de prefixos: cada (thread, vértice) recebe sua posição inicial
+    std::vector<int> bruto(V + 1, 0);
+    Parallel::forRange(0, V, [&](long long a, long long b, int) {
+        for (long long v = a; v < b; ++v) {
+            int soma = 0;
+            for (int i = 0; i < t; ++i) soma += contagem[(size_t)i * V + v];
+            bruto[v + 1] = soma;
+        }
+    });
+    for (int v = 0; v < V; ++v) bruto[v + 1] += bruto[v];
+    Parallel::forRange(0, V, [&](long long a, long long b, int) {
+        for (long long v = a; v < b; ++v) {
+            int pos = bruto[v];
+            for (int i = 0; i < t; ++i) {
+                int c = contagem[(size_t)i * V + v];
+                contagem[(size_t)i * V + v] = pos;
+                pos += c;
+            }
+        }
+    });
+
+    // 3. Distribuição paralela: cada thread escreve só nas suas posições
+    std::vector<Entrada> entradas(bruto[V]);
+    Parallel::forRange(0, t, [&](long long a, long long b, int) {
+        for (long long i = a; i < b; ++i) {
+            int* pos = contagem.data() + (size_t)i * V;
+            for (long long k = limites[i]; k < limites[i + 1]; ++k) {
+                const Edge& e = arestas[k];
+                entradas[pos[e.v]++] = Entrada{e.w, e.weight};
+                if (!directed && e.v != e.w) entradas[pos[e.w]++] = Entrada{e.v, e.weight};
+            }
+        }
+    }, 1);
+    std::vector<int>().swap(contagem);
+
+    // 4. Repetições combinadas na primeira ocorrência de cada destino. A distribuição já
+    // deixou cada lista na ordem da entrada; uma ordenação estável de índices por destino
+    // agrupa as repetições (a primeira à frente) e a lista é compactada sem sair dessa ordem
+    std::vector<int> grau(V + 1, 0);
+    Parallel::forRange(0, V, [&](long long a, long long b, int) {
+        std::vector<int> indices;
+        for (long long v = a; v < b; ++v) {
+            Entrada* lista = entradas.data() + bruto[v];
+            int d = bruto[v + 1] - bruto[v];
+            indices.resize(d);
+            for (int i = 0; i < d; ++i) indices[i] = i;
+            std::stable_sort(indices.begin(), indices.end(),
+                             [lista](int x, int y) { return lista[x].alvo < lista[y].alvo; });
+            for (int i = 1; i < d; ++i) {
+                int primeira = indices[i - 1], atual = indices[i];
+                if (lista[atual].alvo != lista[primeira].alvo) continue;
+                lista[primeira].peso = combinarPeso(lista[primeira].peso, lista[atual].peso, politica);
+                lista[atual].alvo = -1;
+                indices[i] = primeira;  // as próximas repetições também caem na primeira
+            }
+            int unicos = 0;
+            for (int i = 0; i < d; ++i) {
+                if (lista[i].alvo != -1) lista[unicos++] = lista[i];
+            }
+            grau[v + 1] = unicos;
+        }
+    }, 1 << 10);
+
+    auto arrays = std::make_shared<ArraysCSR<W>>();
+    arrays->offsets.assign(V + 1, 0);
+    for (int v = 0; v < V; ++v) arrays->offsets[v + 1] = arrays->offsets[v] + grau[v + 1];
+    int E = arrays->offsets[V];
+    arrays->targets.resize(E);
+    arrays->weights.resize(E);
+    Parallel::forRange(0, V, [&](long long a, long long b, int) {
+        for (long long v = a; v < b; ++v) {
+            int origem = bruto[v];
+            for (int k = arrays->offsets[v]; k < arrays->offsets[v + 1]; ++k, ++origem) {
+                arrays->targets[k] = entradas[origem].alvo;
+                arrays->weights[k] = entradas[origem].peso;
+            }
+        }
+    }, 1 << 10);
+
+    const int* offsets = arrays->offsets.data();
+    const int* targets = arrays->targets.data();
+    const W* weights = arrays->weights.data();
+    return BasicCSRGraph<W>(V, E, directed, offsets, targets, weights, std::move(arrays));
+}
+
+template <typename W>
+BasicCSRGraph<W>::BasicCSRGraph(int V, int E, bool directed, const int* offsets, const int* targets,
+                                const W* weights, std::shared_ptr<const void> dono)
+    : numV(V), numE(E), directed(directed), offsets(offsets), targets(targets), weights(weights),
+      dono(std::move(dono)) {}
+
+template <typename W>
+size_t BasicCSRGraph<W>::memoryUsage() const {
+    return sizeof(*this) + (size_t)(numV + 1) * sizeof(int) + (size_t)numE * (sizeof(int) + sizeof(W));
+}
+
+template <typename W>
+GraphStats BasicCSRGraph<W>::stats() const {
+    GraphStats s = GraphStats::compute(numV, numE, directed, true, [this](int v, auto&& visitar) {
+        for (int e = offsets[v]; e < offsets[v + 1]; ++e) visitar(targets[e], (double)weights[e]);
+    });
+    s.memoryBytes = memoryUsage();
+    return s;
+}
+
+template <typename W>
+BasicCSRGraph<W>::AdjIterator::AdjIterator(const BasicCSRGraph& G, int v)
+    : G(G), v(v), index(G.offsets[v]) {}
+
+template <typename W>
+typename BasicCSRGraph<W>::Edge BasicCSRGraph<W>::AdjIterator::begin() {
+    index = G.offsets[v];
+    return next();
+}
+
+template <typename W>
+typename BasicCSRGraph<W>::Edge BasicCSRGraph<W>::AdjIterator::next() {
+    if (index < G.offsets[v + 1]) {
+        int e = index++;
+        return Edge(v, G.targets[e], G.weights[e]);
+    }
+    else
+        return Edge(-1, -1, W(-1));
+}
+
+template <typename W>
+bool BasicCSRGraph<W>::AdjIterator::end() const {
+    return index >= G.offsets[v + 1];
+}
+
+#define INSTANCIAR_CSR(W) template class BasicCSRGraph<W>;
+FOR_EACH_WEIGHT_TYPE(INSTANCIAR_CSR)
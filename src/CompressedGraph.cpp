@@ -0,0 +1,173 @@
+#include "CompressedGraph.h"
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+
+namespace {
+
+void escreverVarint(std::vector<uint8_t>& saida, uint32_t x) {
+    while (x >= 0x80) {
+        saida.push_back(uint8_t(x) | 0x80);
+        x >>= 7;
+    }
+    saida.push_back(uint8_t(x));
+}
+
+}
+
+template <typename W>
+BasicCompressedGraph<W>::BasicCompressedGraph(int V, bool directed)
+    : numV(V), numE(0), directed(directed), inicioBytes(V + 1, 0), inicioArestas(V + 1, 0) {}
+
+template <typename W>
+void BasicCompressedGraph<W>::appendList(int v, std::span<std::pair<int, W>> lista) {
+    std::stable_sort(lista.begin(), lista.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    int anterior = v;
+    for (size_t i = 0; i < lista.size(); ++i) {
+        int w = lista[i].first;
+        if (i == 0) {
+            int d = w - v;
+            escreverVarint(dados, (uint32_t(d) << 1) ^ uint32_t(d >> 31));
+        } else {
+            escreverVarint(dados, uint32_t(w - anterior));
+        }
+        anterior = w;
+        pesos.push_back(lista[i].second);
+    }
+    inicioBytes[v + 1] = dados.size();
+    inicioArestas[v + 1] = (int)pesos.size();
+}
+
+template <typename W>
+BasicCompressedGraph<W>::BasicCompressedGraph(const BasicWeightedGraph<W>& grafo)
+    : numV(grafo.V()), numE(0), directed(grafo.isDirected()),
+      inicioBytes(numV + 1, 0), inicioArestas(numV + 1, 0) {
+    // Estimativa: cerca de 2 bytes por destino
+    pesos.reserve(directed ? grafo.E() : grafo.E() / 2 + 1);
+    dados.reserve(2 * pesos.capacity());
+
+    std::vector<std::pair<int, W>> lista;
+    for (int v = 0; v < numV; ++v) {
+        for (const auto& e : grafo.neighbors(v)) {
+            if (directed || e.w >= v) lista.push_back({e.w, e.weight});
+        }
+        appendList(v, lista);
+        lista.clear();
+    }
+    numE = (int)pesos.size();
+    dados.shrink_to_fit();
+}
+
+template <typename W>
+BasicCompressedGraph<W>::BasicCompressedGraph(const BasicCSRGraph<W>& grafo)
+    : numV(grafo.V()), numE(0), directed(grafo.isDirected()),
+      inicioBytes(numV + 1, 0), inicioArestas(numV + 1, 0) {
+    pesos.reserve(directed ? grafo.E() : grafo.E() / 2 + 1);
+    dados.reserve(2 * pesos.capacity());
+
+    std::vector<std::pair<int, W>> lista;
+    for (int v = 0; v < numV; ++v) {
+        for (int e = grafo.firstEdge(v); e < grafo.lastEdge(v); ++e) {
+            int w = grafo.target(e);
+            if (directed || w >= v) lista.push_back({w, grafo.weight(e)});
+        }
+        appendList(v, lista);
+        lista.clear();
+    }
+    numE = (int)pesos.size();
+    dados.shrink_to_fit();
+}
+
+template <typename W>
+BasicCompressedGraph<W> BasicCompressedGraph<W>::fromEdgeSource(int V, bool directed, const EdgeSource& fonte,
+                                                                size_t arestasPorPassada) {
+    if (V < 0) throw std::invalid_argument("CompressedGraph: V negativo");
+    arestasPorPassada = std::max<size_t>(arestasPorPassada, 1);
+    // Dono da aresta: a origem ou, sem direção, a menor ponta
+    auto dono = [directed](const Edge& e) { return directed ? e.v : std::min(e.v, e.w); };
+    auto alvo = [directed](const Edge& e) { return directed ? e.w : std::max(e.v, e.w); };
+
+    // Passada 1: tamanho de cada lista
+    std::vector<long long> grau(V, 0);
+    fonte([&](std::span<const Edge> bloco) {
+        for (const Edge& e : bloco) {
+            if (e.v < 0 || e.v >= V || e.w < 0 || e.w >= V)
+                throw std::invalid_argument("CompressedGraph: vértice fora de [0, V)");
+            grau[dono(e)]++;
+        }
+    });
+    long long total = 0;
+    for (long long g : grau) total += g;
+    if (total > INT32_MAX) throw std::invalid_argument("CompressedGraph: arestas demais para índices de 32 bits");
+
+    BasicCompressedGraph grafo(V, directed);
+    grafo.pesos.reserve((size_t)total);
+    grafo.dados.reserve((size_t)total * 2);
+
+    // Passadas seguintes: faixa [a, b) de vértices cujas listas cabem no buffer
+    // (uma lista maior que o buffer vai sozinha)
+    std::vector<std::pair<int, W>> buffer;
+    std::vector<size_t> pos;
+    for (int a = 0; a < V;) {
+        int b = a;
+        size_t soma = 0;
+        while (b < V && (b == a || soma + (size_t)grau[b] <= arestasPorPassada)) soma += (size_t)grau[b++];
+
+        pos.assign(b - a + 1, 0);
+        for (int v = a; v < b; ++v) pos[v - a + 1] = pos[v - a] + (size_t)grau[v];
+        buffer.resize(soma);
+        if (soma > 0) {
+            std::vector<size_t> prox(pos.begin(), pos.end() - 1);
+            fonte([&](std::span<const Edge> bloco) {
+                for (const Edge& e : bloco) {
+                    int d = dono(e);
+                    if (d >= a && d < b) buffer[prox[d - a]++] = {alvo(e), e.weight};
+                }
+            });
+        }
+        for (int v = a; v < b; ++v) {
+            grafo.appendList(v, std::span<std::pair<int, W>>(buffer.data() + pos[v - a], buffer.data() + pos[v - a + 1]));
+        }
+        a = b;
+    }
+    grafo.numE = (int)grafo.pesos.size();
+    grafo.dados.shrink_to_fit();
+    return grafo;
+}
+
+template <typename W>
+BasicCompressedGraph<W> BasicCompressedGraph<W>::fromEdges(int V, std::span<const Edge> arestas, bool directed) {
+    return fromEdgeSource(V, directed, [arestas](const std::function<void(std::span<const Edge>)>& consumir) {
+        consumir(arestas);
+    }, std::max<size_t>(arestas.size(), 1));
+}
+
+template <typename W>
+BasicCompressedGraph<W> BasicCompressedGraph<W>::fromEdgeList(const std::string& caminho, bool directed,
+                                                              EdgeListFormat formato, size_t arestasPorPassada) {
+    auto fonte = [&](const std::function<void(std::span<const Edge>)>& consumir) {
+        EdgeListReader::forEachChunk<W>(caminho, consumir, formato);
+    };
+    // Uma passada só para descobrir V (DIMACS traz na linha "p"; os demais, maior índice + 1)
+    int V = EdgeListReader::forEachChunk<W>(caminho, [](std::span<const Edge>) {}, formato);
+    return fromEdgeSource(V, directed, fonte, arestasPorPassada);
+}
+
+template <typename W>
+size_t BasicCompressedGraph<W>::memoryUsage() const {
+    return dados.capacity() + pesos.capacity() * sizeof(W) +
+           inicioBytes.capacity() * sizeof(uint64_t) + inicioArestas.capacity() * sizeof(int);
+}
+
+template <typename W>
+GraphStats BasicCompressedGraph<W>::stats() const {
+    GraphStats s = GraphStats::compute(numV, numE, directed, true, [this](int v, auto&& visitar) {
+        for (const auto& e : neighbors(v)) visitar(e.w, (double)e.weight);
+    });
+    s.memoryBytes = memoryUsage();
+    return s;
+}
+
+#define INSTANCIAR_COMPRIMIDO(W) template class BasicCompressedGraph<W>;
+FOR_EACH_WEIGHT_TYPE(INSTANCIAR_COMPRIMIDO)
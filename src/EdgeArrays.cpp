@@ -0,0 +1,149 @@
+#include "EdgeArrays.h"
+#include <limits>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define EDGEARRAYS_AVX2 1
+#endif
+
+template <typename W>
+BasicEdgeArrays<W>::BasicEdgeArrays(const BasicWeightedGraph<W>& grafo) : numV(grafo.V()) {
+    reserve(grafo.E());
+    for (const auto& e : grafo.edges()) {
+        push_back(e.v, e.w, e.weight);
+    }
+}
+
+template <typename W>
+BasicEdgeArrays<W>::BasicEdgeArrays(const BasicCSRGraph<W>& grafo) : numV(grafo.V()) {
+    reserve(grafo.E());
+    for (int u = 0; u < numV; ++u) {
+        for (int e = grafo.firstEdge(u); e < grafo.lastEdge(u); ++e) {
+            push_back(u, grafo.target(e), grafo.weight(e));
+        }
+    }
+}
+
+// Decodifica as listas comprimidas uma única vez
+template <typename W>
+BasicEdgeArrays<W>::BasicEdgeArrays(const BasicCompressedGraph<W>& grafo) : numV(grafo.V()) {
+    reserve(grafo.E());
+    for (const auto& e : grafo.edges()) {
+        push_back(e.v, e.w, e.weight);
+    }
+}
+
+template <typename W>
+void BasicEdgeArrays<W>::reserve(int m) {
+    sources.reserve(m);
+    targets.reserve(m);
+    weights.reserve(m);
+}
+
+// Atualização escalar de uma aresta candidata (aplica também os filtros de raiz e laço)
+template <typename W>
+static inline void relaxarEntrada(int e, const int* origens, const int* destinos, const W* pesos,
+                                  int raiz, W* melhorPeso, int* melhorAresta) {
+    int v = destinos[e];
+    if (v == raiz || origens[e] == v) return;
+    if (melhorAresta[v] == -1 || pesos[e] < melhorPeso[v]) {
+        melhorPeso[v] = pesos[e];
+        melhorAresta[v] = e;
+    }
+}
+
+#ifdef EDGEARRAYS_AVX2
+// Filtro vetorial: busca (gather) o melhor peso atual de cada destino e só passa ao laço
+// escalar as arestas com peso <= esse valor. Como o melhor peso por destino só diminui,
+// descartar uma aresta aqui nunca perde um mínimo; conflitos de destino dentro do mesmo
+// bloco são resolvidos pela reavaliação escalar. Retorna quantas arestas foram processadas.
+__attribute__((target("avx2")))
+static int varrerAvx2(int m, const int* origens, const int* destinos, const float* pesos,
+                      int raiz, float* melhorPeso, int* melhorAresta) {
+    int e = 0;
+    for (; e + 8 <= m; e += 8) {
+        __m256i idx = _mm256_loadu_si256((const __m256i*)(destinos + e));
+        __m256 p = _mm256_loadu_ps(pesos + e);
+        __m256 atual = _mm256_i32gather_ps(melhorPeso, idx, 4);
+        unsigned mask = (unsigned)_mm256_movemask_ps(_mm256_cmp_ps(p, atual, _CMP_LE_OQ));
+        while (mask) {
+            int lane = __builtin_ctz(mask);
+            relaxarEntrada(e + lane, origens, destinos, pesos, raiz, melhorPeso, melhorAresta);
+            mask &= mask - 1;
+        }
+    }
+    return e;
+}
+
+__attribute__((target("avx2")))
+static int varrerAvx2(int m, const int* origens, const int* destinos, const int32_t* pesos,
+                      int raiz, int32_t* melhorPeso, int* melhorAresta) {
+    int e = 0;
+    for (; e + 8 <= m; e += 8) {
+        __m256i idx = _mm256_loadu_si256((const __m256i*)(destinos + e));
+        __m256i p = _mm256_loadu_si256((const __m256i*)(pesos + e));
+        __m256i atual = _mm256_i32gather_epi32((const int*)melhorPeso, idx, 4);
+        // p <= atual  <=>  !(p > atual)
+        unsigned maior = (unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(p, atual)));
+        unsigned mask = ~maior & 0xffu;
+        while (mask) {
+            int lane = __builtin_ctz(mask);
+            relaxarEntrada(e + lane, origens, destinos, pesos, raiz, melhorPeso, melhorAresta);
+            mask &= mask - 1;
+        }
+    }
+    return e;
+}
+
+__attribute__((target("avx2")))
+static int varrerAvx2(int m, const int* origens, const int* destinos, const double* pesos,
+                      int raiz, double* melhorPeso, int* melhorAresta) {
+    int e = 0;
+    for (; e + 4 <= m; e += 4) {
+        __m128i idx = _mm_loadu_si128((const __m128i*)(destinos + e));
+        __m256d p = _mm256_loadu_pd(pesos + e);
+        __m256d todos = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+        __m256d atual = _mm256_mask_i32gather_pd(_mm256_setzero_pd(), melhorPeso, idx, todos, 8);
+        unsigned mask = (unsigned)_mm256_movemask_pd(_mm256_cmp_pd(p, atual, _CMP_LE_OQ));
+        while (mask) {
+            int lane = __builtin_ctz(mask);
+            relaxarEntrada(e + lane, origens, destinos, pesos, raiz, melhorPeso, melhorAresta);
+            mask &= mask - 1;
+        }
+    }
+    return e;
+}
+
+static bool avx2Disponivel() {
+    static const bool suportado = __builtin_cpu_supports("avx2");
+    return suportado;
+}
+#endif
+
+template <typename W>
+void BasicEdgeArrays<W>::cheapestIncoming(int root, std::vector<int>& melhorAresta) const {
+    melhorAresta.assign(numV, -1);
+    // Valor inicial máximo: com o filtro "<=" qualquer peso passa enquanto o destino não tem entrada
+    std::vector<W> melhorPeso(numV, std::numeric_limits<W>::has_infinity
+                                        ? std::numeric_limits<W>::infinity()
+                                        : std::numeric_limits<W>::max());
+    int m = E();
+    int e = 0;
+
+#ifdef EDGEARRAYS_AVX2
+    if constexpr (std::is_same_v<W, float> || std::is_same_v<W, int32_t> || std::is_same_v<W, double>) {
+        if (avx2Disponivel()) {
+            e = varrerAvx2(m, sources.data(), targets.data(), weights.data(), root,
+                           melhorPeso.data(), melhorAresta.data());
+        }
+    }
+#endif
+
+    for (; e < m; ++e) {
+        relaxarEntrada(e, sources.data(), targets.data(), weights.data(), root,
+                       melhorPeso.data(), melhorAresta.data());
+    }
+}
+
+#define INSTANCIAR_SOA(W) template class BasicEdgeArrays<W>;
+FOR_EACH_WEIGHT_TYPE(INSTANCIAR_SOA)
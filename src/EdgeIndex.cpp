@@ -0,0 +1,100 @@
+#include "EdgeIndex.h"
+
+static constexpr long long SLOT_VAZIO = -1;
+
+EdgeIndex::EdgeIndex() : ocupados(0) {}
+
+long long EdgeIndex::codificar(int v, int w) {
+    return (static_cast<long long>(v) << 32) | (static_cast<unsigned long long>(w) & 0xffffffffULL);
+}
+
+// Mistura de bits (finalizador do splitmix64) para espalhar chaves sequenciais
+size_t EdgeIndex::espalhar(long long chave) const {
+    unsigned long long x = static_cast<unsigned long long>(chave);
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return static_cast<size_t>(x) & (tabela.size() - 1);
+}
+
+void EdgeIndex::clear() {
+    tabela.clear();
+    ocupados = 0;
+}
+
+void EdgeIndex::reserve(int n) {
+    // Mantém fator de carga <= 1/2
+    size_t capacidade = 16;
+    while (capacidade < 2 * static_cast<size_t>(n)) capacidade <<= 1;
+    if (capacidade <= tabela.size()) return;
+
+    std::vector<Slot> antiga;
+    antiga.swap(tabela);
+    tabela.assign(capacidade, Slot{SLOT_VAZIO, -1});
+    ocupados = 0;
+    for (const auto& slot : antiga) {
+        if (slot.chave == SLOT_VAZIO) continue;
+        size_t i = espalhar(slot.chave);
+        while (tabela[i].chave != SLOT_VAZIO) i = (i + 1) & (tabela.size() - 1);
+        tabela[i] = slot;
+        ocupados++;
+    }
+}
+
+void EdgeIndex::crescer() {
+    reserve(tabela.empty() ? 8 : (int)tabela.size());
+}
+
+int EdgeIndex::find(int v, int w) const {
+    if (tabela.empty()) return -1;
+    long long chave = codificar(v, w);
+    size_t i = espalhar(chave);
+    while (tabela[i].chave != SLOT_VAZIO) {
+        if (tabela[i].chave == chave) return tabela[i].posicao;
+        i = (i + 1) & (tabela.size() - 1);
+    }
+    return -1;
+}
+
+void EdgeIndex::insert(int v, int w, int posicao) {
+    if (2 * (static_cast<size_t>(ocupados) + 1) > tabela.size()) crescer();
+    long long chave = codificar(v, w);
+    size_t i = espalhar(chave);
+    while (tabela[i].chave != SLOT_VAZIO) {
+        if (tabela[i].chave == chave) {
+            tabela[i].posicao = posicao;
+            return;
+        }
+        i = (i + 1) & (tabela.size() - 1);
+    }
+    tabela[i] = Slot{chave, posicao};
+    ocupados++;
+}
+
+void EdgeIndex::erase(int v, int w) {
+    if (tabela.empty()) return;
+    size_t mascara = tabela.size() - 1;
+    long long chave = codificar(v, w);
+    size_t i = espalhar(chave);
+    while (tabela[i].chave != chave) {
+        if (tabela[i].chave == SLOT_VAZIO) return;
+        i = (i + 1) & mascara;
+    }
+
+    // Deslocamento reverso: puxa para trás os elementos da mesma sequência de sondagem
+    size_t j = i;
+    while (true) {
+        j = (j + 1) & mascara;
+        if (tabela[j].chave == SLOT_VAZIO) break;
+        size_t ideal = espalhar(tabela[j].chave);
+        // tabela[j] só pode ocupar o buraco i se i estiver no caminho ideal -> j
+        if (((j - ideal) & mascara) >= ((j - i) & mascara)) {
+            tabela[i] = tabela[j];
+            i = j;
+        }
+    }
+    tabela[i] = Slot{SLOT_VAZIO, -1};
+    ocupados--;
+}
@@ -0,0 +1,265 @@
+#include "EdgeListReader.h"
+#include "Parallel.h"
+#include <algorithm>
+#include <charconv>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+// Arquivo inteiro mapeado somente para leitura (arquivo vazio não é mapeado)
+struct ArquivoTexto {
+    const char* dados = nullptr;
+    size_t tamanho = 0;
+
+    explicit ArquivoTexto(const std::string& caminho) {
+        int fd = open(caminho.c_str(), O_RDONLY);
+        if (fd < 0) throw std::runtime_error("EdgeListReader: não foi possível abrir " + caminho);
+        struct stat st;
+        if (fstat(fd, &st) != 0) {
+            close(fd);
+            throw std::runtime_error("EdgeListReader: não foi possível ler " + caminho);
+        }
+        tamanho = (size_t)st.st_size;
+        if (tamanho > 0) {
+            void* base = mmap(nullptr, tamanho, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (base == MAP_FAILED) {
+                close(fd);
+                throw std::runtime_error("EdgeListReader: mmap falhou para " + caminho);
+            }
+            madvise(base, tamanho, MADV_SEQUENTIAL);
+            dados = static_cast<const char*>(base);
+        }
+        close(fd);
+    }
+    ArquivoTexto(const ArquivoTexto&) = delete;
+    ArquivoTexto& operator=(const ArquivoTexto&) = delete;
+    ~ArquivoTexto() {
+        if (dados) munmap(const_cast<char*>(dados), tamanho);
+    }
+};
+
+EdgeListFormat detectarFormato(const std::string& caminho) {
+    auto termina = [&](const std::string& ext) {
+        return caminho.size() >= ext.size() && caminho.compare(caminho.size() - ext.size(), ext.size(), ext) == 0;
+    };
+    if (termina(".gr") || termina(".dimacs")) return EdgeListFormat::DIMACS;
+    if (termina(".csv")) return EdgeListFormat::CSV;
+    return EdgeListFormat::SNAP;
+}
+
+// Resultado de um bloco: arestas na ordem do bloco e metadados para a junção
+template <typename W>
+struct ParteLida {
+    std::vector<BasicWeightedEdge<W>> arestas;
+    int maiorVertice = -1;
+    long long nDimacs = -1;
+    std::string erro;
+};
+
+class Linha {
+    const char* p;
+    const char* fim;
+    bool csv;
+
+public:
+    Linha(const char* p, const char* fim, bool csv) : p(p), fim(fim), csv(csv) {}
+
+    void pularSeparadores() {
+        while (p < fim && (*p == ' ' || *p == '\t' || (csv && *p == ','))) ++p;
+    }
+    bool acabou() {
+        pularSeparadores();
+        return p >= fim;
+    }
+    char atual() const { return *p; }
+    void avancar() { ++p; }
+
+    template <typename T>
+    bool numero(T& valor) {
+        pularSeparadores();
+        if (p < fim && *p == '+') ++p;
+        auto [q, ec] = std::from_chars(p, fim, valor);
+        if (ec != std::errc()) return false;
+        p = q;
+        return true;
+    }
+
+    void palavra() {
+        pularSeparadores();
+        while (p < fim && *p != ' ' && *p != '\t' && !(csv && *p == ',')) ++p;
+    }
+};
+
+// Interpreta uma linha sem o '\n'; devolve false se ela for malformada
+template <typename W>
+bool interpretarLinha(const char* ini, const char* fim, EdgeListFormat formato, bool primeiraDoArquivo,
+                      ParteLida<W>& parte) {
+    if (fim > ini && fim[-1] == '\r') --fim;
+    bool csv = formato == EdgeListFormat::CSV;
+    Linha linha(ini, fim, csv);
+    if (linha.acabou()) return true;
+
+    char c = linha.atual();
+    int base = 0;
+    if (formato == EdgeListFormat::DIMACS) {
+        if (c == 'c') return true;
+        if (c == 'p') {
+            linha.avancar();
+            linha.palavra(); // "sp", "edge", ...
+            long long n;
+            if (!linha.numero(n)) return false;
+            parte.nDimacs = n;
+            return true;
+        }
+        if (c != 'a' && c != 'e') return false;
+        linha.avancar();
+        base = 1;
+    } else if (c == '#' || c == '%') {
+        return true;
+    }
+
+    int u, v;
+    if (!linha.numero(u) || !linha.numero(v)) {
+        // Cabeçalho do CSV ("origem,destino,peso")
+        return csv && primeiraDoArquivo;
+    }
+    W peso = W(1);
+    if (!linha.acabou() && !linha.numero(peso)) return false;
+    if (!linha.acabou()) return false;
+
+    u -= base;
+    v -= base;
+    if (u < 0 || v < 0) return false;
+    parte.arestas.push_back(BasicWeightedEdge<W>(u, v, peso));
+    parte.maiorVertice = std::max(parte.maiorVertice, std::max(u, v));
+    return true;
+}
+
+// Interpreta a janela [ini, fim) do arquivo (alinhada a fim de linha): um bloco por
+// thread (mínimo de 1 MiB), com fronteiras movidas para depois de um '\n'. As partes
+// saem na ordem do arquivo; a primeira linha do arquivo é a do bloco que começa em 0
+template <typename W>
+std::vector<ParteLida<W>> lerJanela(const char* dados, long long ini, long long fim, EdgeListFormat formato,
+                                    const std::string& caminho) {
+    long long n = fim - ini;
+    const long long GRAO = 1 << 20;
+    int t = (int)std::min<long long>(Parallel::numThreads(), std::max<long long>(1, n / GRAO));
+    std::vector<long long> limites(t + 1);
+    limites[0] = ini;
+    limites[t] = fim;
+    for (int i = 1; i < t; ++i) {
+        long long pos = std::max(limites[i - 1], ini + n * i / t);
+        while (pos < fim && pos > ini && dados[pos - 1] != '\n') ++pos;
+        limites[i] = pos;
+    }
+
+    std::vector<ParteLida<W>> partes(t);
+    Parallel::forRange(0, t, [&](long long a, long long b, int) {
+        for (long long i = a; i < b; ++i) {
+            ParteLida<W>& parte = partes[i];
+            const char* p = dados + limites[i];
+            const char* fimBloco = dados + limites[i + 1];
+            // Estimativa grosseira de ~16 bytes por linha
+            parte.arestas.reserve((size_t)(fimBloco - p) / 16);
+            bool primeira = (limites[i] == 0);
+            while (p < fimBloco) {
+                const char* fimLinha = std::find(p, fimBloco, '\n');
+                if (!interpretarLinha(p, fimLinha, formato, primeira, parte)) {
+                    parte.erro = std::string(p, std::min<const char*>(fimLinha, p + 80));
+                    return;
+                }
+                primeira = false;
+                p = fimLinha + 1;
+            }
+        }
+    }, 1);
+
+    for (const auto& parte : partes) {
+        if (!parte.erro.empty())
+            throw std::runtime_error("EdgeListReader: linha inválida em " + caminho + ": \"" + parte.erro + "\"");
+    }
+    return partes;
+}
+
+}
+
+template <typename W>
+std::vector<BasicWeightedEdge<W>> EdgeListReader::read(const std::string& caminho, int& numVertices,
+                                                       EdgeListFormat formato) {
+    if (formato == EdgeListFormat::AUTO) formato = detectarFormato(caminho);
+
+    ArquivoTexto arquivo(caminho);
+    std::vector<ParteLida<W>> partes = lerJanela<W>(arquivo.dados, 0, (long long)arquivo.tamanho, formato, caminho);
+    int t = (int)partes.size();
+
+    int maior = -1;
+    long long nDimacs = -1;
+    std::vector<size_t> inicio(t + 1, 0);
+    for (int i = 0; i < t; ++i) {
+        maior = std::max(maior, partes[i].maiorVertice);
+        if (partes[i].nDimacs >= 0) nDimacs = partes[i].nDimacs;
+        inicio[i + 1] = inicio[i] + partes[i].arestas.size();
+    }
+
+    // Junção paralela: cada bloco copia suas arestas para a posição final
+    std::vector<BasicWeightedEdge<W>> arestas(inicio[t]);
+    Parallel::forRange(0, t, [&](long long a, long long b, int) {
+        for (long long i = a; i < b; ++i) {
+            std::copy(partes[i].arestas.begin(), partes[i].arestas.end(), arestas.begin() + inicio[i]);
+        }
+    }, 1);
+
+    numVertices = (int)std::max<long long>(nDimacs, maior + 1);
+    return arestas;
+}
+
+template <typename W>
+int EdgeListReader::forEachChunk(const std::string& caminho,
+                                 const std::function<void(std::span<const BasicWeightedEdge<W>>)>& consumir,
+                                 EdgeListFormat formato, size_t bytesPorBloco) {
+    if (formato == EdgeListFormat::AUTO) formato = detectarFormato(caminho);
+    if (bytesPorBloco == 0) throw std::invalid_argument("EdgeListReader: bytesPorBloco deve ser positivo");
+
+    ArquivoTexto arquivo(caminho);
+    const char* dados = arquivo.dados;
+    long long n = (long long)arquivo.tamanho;
+
+    int maior = -1;
+    long long nDimacs = -1;
+    for (long long ini = 0; ini < n;) {
+        // Janela terminada logo após um '\n' (ou no fim do arquivo)
+        long long fim = std::min(n, ini + (long long)bytesPorBloco);
+        while (fim < n && dados[fim - 1] != '\n') ++fim;
+
+        for (const auto& parte : lerJanela<W>(dados, ini, fim, formato, caminho)) {
+            maior = std::max(maior, parte.maiorVertice);
+            if (parte.nDimacs >= 0) nDimacs = parte.nDimacs;
+            if (!parte.arestas.empty()) consumir(parte.arestas);
+        }
+        // As páginas já lidas podem sair da memória
+        madvise(const_cast<char*>(dados) + (ini & ~(long long)4095), (size_t)(fim - (ini & ~(long long)4095)), MADV_DONTNEED);
+        ini = fim;
+    }
+    return (int)std::max<long long>(nDimacs, maior + 1);
+}
+
+template <typename W>
+BasicWeightedGraph<W> EdgeListReader::load(const std::string& caminho, bool directed,
+                                           EdgeListFormat formato, DuplicatePolicy politica) {
+    int numVertices = 0;
+    std::vector<BasicWeightedEdge<W>> arestas = read<W>(caminho, numVertices, formato);
+    BasicWeightedGraph<W> grafo(numVertices, directed);
+    grafo.insertEdges(arestas, politica);
+    return grafo;
+}
+
+#define INSTANCIAR_LEITOR(W) \
+    template std::vector<BasicWeightedEdge<W>> EdgeListReader::read(const std::string&, int&, EdgeListFormat); \
+    template BasicWeightedGraph<W> EdgeListReader::load(const std::string&, bool, EdgeListFormat, DuplicatePolicy); \
+    template int EdgeListReader::forEachChunk(const std::string&, \
+        const std::function<void(std::span<const BasicWeightedEdge<W>>)>&, EdgeListFormat, size_t);
+FOR_EACH_WEIGHT_TYPE(INSTANCIAR_LEITOR)
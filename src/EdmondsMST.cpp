@@ -1,48 +1,65 @@
 #include "EdmondsMST.h"
+#include "Parallel.h"
 #include <algorithm>
 #include <limits>
+#include <memory_resource>
 #include <unordered_map>
 #include <iostream>
 
 using namespace std;
 
-static constexpr double INFINITE_COST = std::numeric_limits<double>::infinity();
-
 long long EdmondsMST::encode_edge_key(int from, int to) {
     return (static_cast<long long>(from) << 32) ^ (static_cast<unsigned long long>(to) & 0xffffffffULL);
 }
 
-std::vector<EdmondsMST::DirectedEdgeInternal> EdmondsMST::find_cheapest_incoming_edges(WeightedGraph& graph, int root) {
-    int n = graph.V();
-    std::vector<DirectedEdgeInternal> cheapest_edges(n);
-    std::vector<double> min_costs(n, INFINITE_COST);
-
-    for (int u = 0; u < n; ++u) {
-        WeightedGraph::AdjIterator it(graph, u);
-        WeightedEdge e = it.begin();
-        while (e.v != -1) {
-            int v = e.w;
-            if (v != root && u != v) { 
-                if (e.weight < min_costs[v]) {
-                    min_costs[v] = e.weight;
-                    cheapest_edges[v] = DirectedEdgeInternal(u, v, e.weight);
-                }
-            }
-            if(it.end()) break;
-            e = it.next();
-        }
-    }
-    
+template <typename W>
+std::vector<EdmondsMST::DirectedEdgeInternal<W>> EdmondsMST::find_cheapest_incoming_edges(const BasicEdgeArrays<W>& edges, int root) {
+    int n = edges.V();
+    std::vector<DirectedEdgeInternal<W>> cheapest_edges(n);
+
+    // Varredura SoA: só destinos e pesos são lidos no laço quente (AVX2 quando disponível)
+    std::vector<int> best_edge;
+    edges.cheapestIncoming(root, best_edge);
+
     for(int v=0; v<n; ++v) {
-        if (v != root && min_costs[v] == INFINITE_COST) {
+        if (v == root) continue;
+        int id = best_edge[v];
+        if (id == -1) {
              cheapest_edges[v].u = -1; 
+        } else {
+            cheapest_edges[v] = DirectedEdgeInternal<W>(edges.source(id), v, edges.weight(id));
         }
     }
 
     return cheapest_edges;
 }
 
-EdmondsMST::CycleDetectionResult EdmondsMST::detect_cycles(const std::vector<DirectedEdgeInternal>& cheapest_edges, 
+template <typename W>
+std::vector<EdmondsMST::DirectedEdgeInternal<W>> EdmondsMST::find_cheapest_incoming_edges(const BasicWeightedGraph<W>& graph, int root) {
+    int n = graph.V();
+    std::vector<DirectedEdgeInternal<W>> cheapest_edges(n);
+
+    // Cada destino lê só a própria lista de entrada: alvos independentes, divididos entre threads
+    Parallel::forRange(0, n, [&](long long first, long long last, int) {
+        for (int v = (int)first; v < (int)last; ++v) {
+            if (v == root) continue;
+            bool found = false;
+            for (const auto& e : graph.inEdges(v)) {
+                if (e.v == v) continue;
+                if (!found || e.weight < cheapest_edges[v].cost) {
+                    found = true;
+                    cheapest_edges[v] = DirectedEdgeInternal<W>(e.v, v, e.weight);
+                }
+            }
+            if (!found) cheapest_edges[v].u = -1;
+        }
+    }, 4096);
+
+    return cheapest_edges;
+}
+
+template <typename W>
+EdmondsMST::CycleDetectionResult EdmondsMST::detect_cycles(const std::vector<DirectedEdgeInternal<W>>& cheapest_edges, 
                                                          int num_vertices, int root) {
     CycleDetectionResult result;
     result.cycle_id_of_vertex.assign(num_vertices, -1);
@@ -81,16 +98,25 @@ EdmondsMST::CycleDetectionResult EdmondsMST::detect_cycles(const std::vector<Dir
     return result;
 }
 
-EdmondsMST::InternalResult EdmondsMST::run_chu_liu(WeightedGraph& graph, int root_vertex) {
+template <typename Graph>
+EdmondsMST::InternalResult<typename Graph::Weight> EdmondsMST::run_chu_liu(const Graph& graph, int root_vertex) {
+    using W = typename Graph::Weight;
     int n = graph.V();
-    InternalResult result(n);
+    InternalResult<W> result(n);
 
     if (n == 0 || root_vertex < 0 || root_vertex >= n) {
         result.success = false;
         return result;
     }
 
-    auto cheapest_edges = find_cheapest_incoming_edges(graph, root_vertex);
+    BasicEdgeArrays<W> edges(graph);
+    std::vector<DirectedEdgeInternal<W>> cheapest_edges;
+    if constexpr (std::is_same_v<Graph, BasicWeightedGraph<W>>) {
+        graph.inEdges(0); // constrói a adjacência transposta antes da divisão entre threads
+        cheapest_edges = find_cheapest_incoming_edges(graph, root_vertex);
+    } else {
+        cheapest_edges = find_cheapest_incoming_edges(edges, root_vertex);
+    }
 
     for (int v = 0; v < n; ++v) {
         if (v == root_vertex) continue;
@@ -113,53 +139,58 @@ EdmondsMST::InternalResult EdmondsMST::run_chu_liu(WeightedGraph& graph, int roo
 
     int cycle_count = (int)cycle_detection.cycles.size();
     std::vector<int> component_id(n, -1);
-    
-    for (int v = 0; v < n; ++v) {
-        if (cycle_detection.cycle_id_of_vertex[v] != -1) {
-            component_id[v] = cycle_detection.cycle_id_of_vertex[v];
-        }
-    }
 
-    int next_id = cycle_count;
+    // Rótulos na ordem do menor vértice de cada componente (e não na ordem em que os
+    // ciclos foram achados): o grafo contraído herda a localidade da numeração original
+    std::vector<int> cycle_component(cycle_count, -1);
+    int next_id = 0;
     for (int v = 0; v < n; ++v) {
-        if (component_id[v] == -1) {
+        int c = cycle_detection.cycle_id_of_vertex[v];
+        if (c == -1) {
             component_id[v] = next_id++;
+        } else {
+            if (cycle_component[c] == -1) cycle_component[c] = next_id++;
+            component_id[v] = cycle_component[c];
         }
     }
 
     int contracted_vertices = next_id;
     int contracted_root = component_id[root_vertex];
 
-    WeightedGraph contracted(contracted_vertices, true);
-    std::unordered_map<long long, ContractedEdgeInfo> edge_mapping;
-
-    for (int u = 0; u < n; ++u) {
-        WeightedGraph::AdjIterator it(graph, u);
-        WeightedEdge e = it.begin();
-        while (e.v != -1) {
-            int from_comp = component_id[u];
-            int to_comp = component_id[e.w];
+    // Arena deste nível: listas do grafo contraído e mapa de arestas saem de poucos blocos
+    // grandes e são liberados de uma vez no retorno (níveis já resolvidos não ocupam memória)
+    std::pmr::monotonic_buffer_resource arena(
+        contracted_vertices * sizeof(std::pmr::vector<typename BasicWeightedGraph<W>::Edge>) +
+        (size_t)edges.E() * (sizeof(typename BasicWeightedGraph<W>::Edge) + sizeof(ContractedEdgeInfo<W>)));
+
+    BasicWeightedGraph<W> contracted(contracted_vertices, true, &arena);
+    // Supervértices concentram muitas arestas: consultas por (from, to) em O(1) esperado
+    contracted.enableEdgeIndex();
+    std::pmr::unordered_map<long long, ContractedEdgeInfo<W>> edge_mapping(&arena);
+
+    for (int id = 0; id < edges.E(); ++id) {
+        int u = edges.source(id);
+        int target = edges.target(id);
+        W weight = edges.weight(id);
+        int from_comp = component_id[u];
+        int to_comp = component_id[target];
+
+        if (from_comp != to_comp) {
+            W adjusted_cost = weight;
+            if (cycle_detection.cycle_id_of_vertex[target] != -1) {
+                adjusted_cost -= cheapest_edges[target].cost;
+            }
 
-            if (from_comp != to_comp) {
-                double adjusted_cost = e.weight;
-                if (cycle_detection.cycle_id_of_vertex[e.w] != -1) {
-                    adjusted_cost -= cheapest_edges[e.w].cost;
-                }
+            long long key = encode_edge_key(from_comp, to_comp);
+            
+            std::optional<W> current_cost = contracted.getWeight(from_comp, to_comp);
 
-                long long key = encode_edge_key(from_comp, to_comp);
+            if (!current_cost || adjusted_cost < *current_cost) {
+                if (current_cost) contracted.updateWeight(from_comp, to_comp, adjusted_cost);
+                else contracted.insertEdge(from_comp, to_comp, adjusted_cost);
                 
-                bool exists = contracted.hasEdge(from_comp, to_comp);
-                double current_cost = exists ? contracted.getWeight(from_comp, to_comp) : INFINITE_COST;
-
-                if (!exists || adjusted_cost < current_cost) {
-                    if (exists) contracted.updateWeight(from_comp, to_comp, adjusted_cost);
-                    else contracted.insertEdge(from_comp, to_comp, adjusted_cost);
-                    
-                    edge_mapping[key] = {from_comp, to_comp, adjusted_cost, u, e.w, e.weight};
-                }
+                edge_mapping[key] = {from_comp, to_comp, adjusted_cost, u, target, weight};
             }
-            if(it.end()) break;
-            e = it.next();
         }
     }
 
@@ -194,18 +225,58 @@ EdmondsMST::InternalResult EdmondsMST::run_chu_liu(WeightedGraph& graph, int roo
     return result;
 }
 
-WeightedGraph EdmondsMST::obterArborescencia(WeightedGraph& grafo, int raiz) {
-    auto internal_res = run_chu_liu(grafo, raiz);
-    
-    WeightedGraph mst(grafo.V(), true);
+template <typename W>
+BasicArborescenceResult<W> EdmondsMST::build_result(const InternalResult<W>& internal_res, int num_vertices, int root) {
+    BasicArborescenceResult<W> result(num_vertices, root, true);
     if (!internal_res.success) {
-        return mst;
+        result.success = false;
+        return result;
     }
 
-    for (int i = 0; i < grafo.V(); ++i) {
-        if (i != raiz && internal_res.parent[i] != -1) {
-            mst.insertEdge(internal_res.parent[i], i, internal_res.edge_costs[i]);
+    for (int i = 0; i < num_vertices; ++i) {
+        if (i != root && internal_res.parent[i] != -1) {
+            result.parent[i] = internal_res.parent[i];
+            result.parentWeight[i] = internal_res.edge_costs[i];
         }
     }
-    return mst;
-}
\ No newline at end of file
+    return result;
+}
+
+template <typename W>
+BasicArborescenceResult<W> EdmondsMST::obterPaisArborescencia(const BasicWeightedGraph<W>& grafo, int raiz) {
+    BasicArborescenceResult<W> result = build_result(run_chu_liu(grafo, raiz), grafo.V(), raiz);
+    result.locateEdges(grafo);
+    return result;
+}
+
+template <typename W>
+BasicArborescenceResult<W> EdmondsMST::obterPaisArborescencia(const BasicCSRGraph<W>& grafo, int raiz) {
+    BasicArborescenceResult<W> result = build_result(run_chu_liu(grafo, raiz), grafo.V(), raiz);
+    result.locateEdges(grafo);
+    return result;
+}
+
+template <typename W>
+BasicArborescenceResult<W> EdmondsMST::obterPaisArborescencia(const BasicCompressedGraph<W>& grafo, int raiz) {
+    BasicArborescenceResult<W> result = build_result(run_chu_liu(grafo, raiz), grafo.V(), raiz);
+    result.locateEdges(grafo);
+    return result;
+}
+
+template <typename W>
+BasicWeightedGraph<W> EdmondsMST::obterArborescencia(const BasicWeightedGraph<W>& grafo, int raiz) {
+    return obterPaisArborescencia(grafo, raiz).toWeightedGraph();
+}
+
+template <typename W>
+BasicWeightedGraph<W> EdmondsMST::obterArborescencia(const BasicCSRGraph<W>& grafo, int raiz) {
+    return obterPaisArborescencia(grafo, raiz).toWeightedGraph();
+}
+
+#define INSTANCIAR_EDMONDS(W) \
+    template BasicWeightedGraph<W> EdmondsMST::obterArborescencia(const BasicWeightedGraph<W>&, int); \
+    template BasicWeightedGraph<W> EdmondsMST::obterArborescencia(const BasicCSRGraph<W>&, int); \
+    template BasicArborescenceResult<W> EdmondsMST::obterPaisArborescencia(const BasicWeightedGraph<W>&, int); \
+    template BasicArborescenceResult<W> EdmondsMST::obterPaisArborescencia(const BasicCSRGraph<W>&, int); \
+    template BasicArborescenceResult<W> EdmondsMST::obterPaisArborescencia(const BasicCompressedGraph<W>&, int);
+FOR_EACH_WEIGHT_TYPE(INSTANCIAR_EDMONDS)
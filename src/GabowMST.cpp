@@ -4,17 +4,20 @@
 #include <algorithm>
 #include <iostream>
 #include <memory>
+#include <memory_resource>
 
 using namespace std;
 
+// Chave do heap: custo reduzido (inteiros usam 64 bits com sinal, ver AccumWeight)
+template <typename K>
 struct GabowNode {
-    double val;          
-    double lazy;          
+    K val;          
+    K lazy;          
     int u, v;             
     int idOriginal;       
     GabowNode *left, *right;
 
-    GabowNode(double w, int _u, int _v, int _id) 
+    GabowNode(K w, int _u, int _v, int _id) 
         : val(w), lazy(0), u(_u), v(_v), idOriginal(_id), left(nullptr), right(nullptr) {}
 };
 
@@ -28,25 +31,26 @@ struct CicloInfo {
     vector<ComponenteCiclo> componentes; 
 };
 
+template <typename K>
 class GabowSolver {
 private:
-    vector<GabowNode*> nodePool; 
+    using GabowNode = ::GabowNode<K>;
+
+    // Um nó por aresta, todos vivos até o fim: arena monotônica dimensionada para m nós
+    // (os nós são trivialmente destrutíveis, a arena libera tudo de uma vez)
+    std::pmr::monotonic_buffer_resource nodePool;
+    std::pmr::polymorphic_allocator<GabowNode> alocador;
     vector<int> paiDSU;          
 
 public:
-    GabowSolver(int n) {
+    GabowSolver(int n, int m)
+        : nodePool(std::max(1, m) * sizeof(GabowNode)), alocador(&nodePool) {
         paiDSU.resize(2 * n);
         for(int i = 0; i < 2 * n; ++i) paiDSU[i] = i;
     }
 
-    ~GabowSolver() {
-        for(auto ptr : nodePool) delete ptr;
-    }
-
-    GabowNode* novoNo(double w, int u, int v, int id) {
-        GabowNode* node = new GabowNode(w, u, v, id);
-        nodePool.push_back(node);
-        return node;
+    GabowNode* novoNo(K w, int u, int v, int id) {
+        return alocador.template new_object<GabowNode>(w, u, v, id);
     }
 
     void push_lazy(GabowNode* t) {
@@ -71,7 +75,7 @@ public:
         return a;
     }
 
-    GabowNode* push(GabowNode* root, double w, int u, int v, int id) {
+    GabowNode* push(GabowNode* root, K w, int u, int v, int id) {
         return merge(root, novoNo(w, u, v, id));
     }
 
@@ -99,32 +103,23 @@ public:
     }
 };
 
-WeightedGraph GabowMST::obterArborescencia(WeightedGraph& grafo, int raiz) {
-    int V = grafo.V();
-    
-    vector<WeightedEdge> arestasReais; 
-    
-    GabowSolver solver(V);
+// Núcleo do algoritmo: recebe as arestas candidatas (SoA) já filtradas (sem laços e sem entrar na raiz)
+template <typename W>
+static BasicArborescenceResult<W> resolverGabow(int V, int raiz, const BasicEdgeArrays<W>& arestasReais) {
+    using K = AccumWeight<W>;
+    using GabowNode = ::GabowNode<K>;
+    GabowSolver<K> solver(V, arestasReais.E());
 
     vector<GabowNode*> queues(2 * V, nullptr); 
 
-    int idCounter = 0;
-    for (int i = 0; i < V; ++i) {
-        WeightedGraph::AdjIterator it(grafo, i);
-        WeightedEdge e = it.begin();
-        while (e.v != -1) {
-            if (e.w != raiz && e.v != e.w) {
-                queues[e.w] = solver.push(queues[e.w], e.weight, e.v, e.w, idCounter);
-                arestasReais.push_back(e);
-                idCounter++;
-            }
-            if (it.end()) break;
-            e = it.next();
-        }
+    for (int idCounter = 0; idCounter < arestasReais.E(); ++idCounter) {
+        int v = arestasReais.target(idCounter);
+        queues[v] = solver.push(queues[v], arestasReais.weight(idCounter), arestasReais.source(idCounter), v, idCounter);
     }
 
     vector<int> estado(2 * V, 0);
     vector<int> arestaEntradaEscolhida(2 * V, -1); 
+    vector<K> custoEntrada(2 * V, K(0));  // Custo reduzido da aresta escolhida (chave no heap)
     vector<int> paiNaHierarquia(2 * V, -1); 
     stack<CicloInfo> pilhaCiclos;
     
@@ -139,10 +134,10 @@ WeightedGraph GabowMST::obterArborescencia(WeightedGraph& grafo, int raiz) {
         while (estado[curr] != 2) {
             estado[curr] = 1; 
 
-            GabowNode* minNode = queues[curr];
+            GabowNode* minNode = solver.top(queues[curr]);
             while (minNode && solver.find(minNode->u) == curr) {
                 queues[curr] = solver.pop(queues[curr]);
-                minNode = queues[curr];
+                minNode = solver.top(queues[curr]);
             }
 
             if (!minNode) {
@@ -151,6 +146,7 @@ WeightedGraph GabowMST::obterArborescencia(WeightedGraph& grafo, int raiz) {
             }
 
             arestaEntradaEscolhida[curr] = minNode->idOriginal;
+            custoEntrada[curr] = minNode->val;
             int origem = solver.find(minNode->u);
 
             if (estado[origem] == 1) {
@@ -160,31 +156,22 @@ WeightedGraph GabowMST::obterArborescencia(WeightedGraph& grafo, int raiz) {
                 
                 GabowNode* heapUniao = nullptr;
 
+                // Percorre o ciclo pelas origens das arestas escolhidas (curr -> origem -> ... -> curr);
+                // curr já foi unido, então a volta a ele aparece como novoSuperNo
                 int iter = curr;
-                while (iter != origem) {
+                do {
                     int edgeId = arestaEntradaEscolhida[iter];
+                    int proximo = solver.find(arestasReais.source(edgeId));
                     ciclo.componentes.push_back({iter, edgeId});
                     paiNaHierarquia[iter] = novoSuperNo;
 
                     GabowNode* h = queues[iter];
-                    if (h) h->lazy -= arestasReais[edgeId].weight;
+                    if (h) h->lazy -= custoEntrada[iter];  // custo reduzido, não o peso original
                     heapUniao = solver.merge(heapUniao, h);
 
                     solver.unite(iter, novoSuperNo); 
-                    
-                    // Retrocede no ciclo
-                    iter = solver.find(arestasReais[edgeId].v); // .v é origem
-                }
-
-                int edgeIdOrigem = minNode->idOriginal;
-                ciclo.componentes.push_back({origem, edgeIdOrigem});
-                paiNaHierarquia[origem] = novoSuperNo;
-
-                GabowNode* h = queues[origem];
-                if (h) h->lazy -= arestasReais[edgeIdOrigem].weight;
-                heapUniao = solver.merge(heapUniao, h);
-                
-                solver.unite(origem, novoSuperNo);
+                    iter = proximo;
+                } while (iter != novoSuperNo);
 
                 queues[novoSuperNo] = heapUniao;
                 estado[novoSuperNo] = 1; 
@@ -202,7 +189,7 @@ WeightedGraph GabowMST::obterArborescencia(WeightedGraph& grafo, int raiz) {
             estado[temp] = 2;
             if (arestaEntradaEscolhida[temp] == -1) break;
             
-            int parent = solver.find(arestasReais[arestaEntradaEscolhida[temp]].v);
+            int parent = solver.find(arestasReais.source(arestaEntradaEscolhida[temp]));
             if (parent == temp) break;
             temp = parent;
         }
@@ -218,7 +205,7 @@ WeightedGraph GabowMST::obterArborescencia(WeightedGraph& grafo, int raiz) {
         int subComponenteEntrada = -1;
 
         if (arestaQueEntraNoSuperNo != -1) {
-            int destinoReal = arestasReais[arestaQueEntraNoSuperNo].w; 
+            int destinoReal = arestasReais.target(arestaQueEntraNoSuperNo); 
             
             int temp = destinoReal;
             while (paiNaHierarquia[temp] != superNo && paiNaHierarquia[temp] != -1) {
@@ -236,15 +223,94 @@ WeightedGraph GabowMST::obterArborescencia(WeightedGraph& grafo, int raiz) {
         }
     }
 
-    WeightedGraph resultado(V, true);
+    BasicArborescenceResult<W> resultado(V, raiz, true);
     for (int i = 0; i < V; ++i) {
         if (i == raiz) continue;
         int edgeID = arestaEntradaEscolhida[i];
         if (edgeID != -1) {
-            const auto& aresta = arestasReais[edgeID];
-            resultado.insertEdge(aresta.v, aresta.w, aresta.weight);
+            resultado.parent[arestasReais.target(edgeID)] = arestasReais.source(edgeID);
+            resultado.parentWeight[arestasReais.target(edgeID)] = arestasReais.weight(edgeID);
+        }
+    }
+
+    // success com o mesmo sentido do Edmonds e do Tarjan
+    resultado.success = resultado.reachesRoot();
+    return resultado;
+}
+
+template <typename W>
+BasicArborescenceResult<W> GabowMST::obterPaisArborescencia(const BasicWeightedGraph<W>& grafo, int raiz) {
+    int V = grafo.V();
+    BasicEdgeArrays<W> arestasReais(V);
+    arestasReais.reserve(grafo.E());
+
+    // Arestas agrupadas por destino (lista de entrada): cada heap recebe as suas em sequência
+    for (int v = 0; v < V; ++v) {
+        if (v == raiz) continue;
+        for (const auto& e : grafo.inEdges(v)) {
+            if (e.v != v) {
+                arestasReais.push_back(e.v, v, e.weight);
+            }
+        }
+    }
+
+    BasicArborescenceResult<W> resultado = resolverGabow(V, raiz, arestasReais);
+    resultado.locateEdges(grafo);
+    return resultado;
+}
+
+template <typename W>
+BasicArborescenceResult<W> GabowMST::obterPaisArborescencia(const BasicCSRGraph<W>& grafo, int raiz) {
+    int V = grafo.V();
+    BasicEdgeArrays<W> arestasReais(V);
+    arestasReais.reserve(grafo.E());
+
+    for (int u = 0; u < V; ++u) {
+        for (int e = grafo.firstEdge(u); e < grafo.lastEdge(u); ++e) {
+            int v = grafo.target(e);
+            if (v != raiz && u != v) {
+                arestasReais.push_back(u, v, grafo.weight(e));
+            }
+        }
+    }
+
+    BasicArborescenceResult<W> resultado = resolverGabow(V, raiz, arestasReais);
+    resultado.locateEdges(grafo);
+    return resultado;
+}
+
+// Listas comprimidas decodificadas uma vez, direto para as arestas candidatas
+template <typename W>
+BasicArborescenceResult<W> GabowMST::obterPaisArborescencia(const BasicCompressedGraph<W>& grafo, int raiz) {
+    int V = grafo.V();
+    BasicEdgeArrays<W> arestasReais(V);
+    arestasReais.reserve(grafo.E());
+
+    for (const auto& e : grafo.edges()) {
+        if (e.w != raiz && e.v != e.w) {
+            arestasReais.push_back(e.v, e.w, e.weight);
         }
     }
 
+    BasicArborescenceResult<W> resultado = resolverGabow(V, raiz, arestasReais);
+    resultado.locateEdges(grafo);
     return resultado;
-}
\ No newline at end of file
+}
+
+template <typename W>
+BasicWeightedGraph<W> GabowMST::obterArborescencia(const BasicWeightedGraph<W>& grafo, int raiz) {
+    return obterPaisArborescencia(grafo, raiz).toWeightedGraph();
+}
+
+template <typename W>
+BasicWeightedGraph<W> GabowMST::obterArborescencia(const BasicCSRGraph<W>& grafo, int raiz) {
+    return obterPaisArborescencia(grafo, raiz).toWeightedGraph();
+}
+
+#define INSTANCIAR_GABOW(W) \
+    template BasicWeightedGraph<W> GabowMST::obterArborescencia(const BasicWeightedGraph<W>&, int); \
+    template BasicWeightedGraph<W> GabowMST::obterArborescencia(const BasicCSRGraph<W>&, int); \
+    template BasicArborescenceResult<W> GabowMST::obterPaisArborescencia(const BasicWeightedGraph<W>&, int); \
+    template BasicArborescenceResult<W> GabowMST::obterPaisArborescencia(const BasicCSRGraph<W>&, int); \
+    template BasicArborescenceResult<W> GabowMST::obterPaisArborescencia(const BasicCompressedGraph<W>&, int);
+FOR_EACH_WEIGHT_TYPE(INSTANCIAR_GABOW)
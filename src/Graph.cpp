@@ -1,4 +1,5 @@
 #include "Graph.h"
+#include <algorithm>
 #include <iostream>
 using namespace std;
 
@@ -9,37 +10,43 @@ int GraphBase::V() const { return numV; }
 int GraphBase::E() const { return numE; }
 bool GraphBase::isDirected() const { return directed; }
 
-Graph::Graph(int V, bool directed) : GraphBase(V, directed), adj(V) {}
+Graph::Graph(int V, bool directed, std::pmr::memory_resource* recurso)
+    : GraphBase(V, directed), adj(V, recurso), removido(V, 0, recurso), lapides(V, 0, recurso),
+      grauEntrada(V, 0, recurso), verticesRemovidos(0), limiteCompactacao(0.25) {}
 Graph::~Graph() {}
 
 void Graph::insertVertex() {
-    adj.push_back(std::vector<Edge>());
+    adj.emplace_back();
+    removido.push_back(0);
+    lapides.push_back(0);
+    grauEntrada.push_back(0);
     numV++;
 }
 
+// Arestas que chegam em v não são tocadas: ficam penduradas até compact() e viva() as ignora
 void Graph::removeVertex(int v) {
-    if (v < 0 || v >= numV) return;
-    numE -= adj[v].size();
-    adj.erase(adj.begin() + v);
-    for (auto& lista : adj) {
-        for (auto it = lista.begin(); it != lista.end(); ) {
-            if (it->w == v) {
-                it = lista.erase(it);
-                numE--;
-            } else {
-                if (it->w > v) it->w--;
-                if (it->v > v) it->v--;
-                ++it;
-            }
-        }
+    if (v < 0 || v >= numV || removido[v]) return;
+    for (const auto& e : adj[v]) {
+        if (!viva(e)) continue;
+        numE--;
+        if (directed) grauEntrada[e.w]--;
+    }
+    if (directed) {
+        numE -= grauEntrada[v];
+        grauEntrada[v] = 0;
     }
-    numV--;
+    adj[v].clear();
+    lapides[v] = 0;
+    removido[v] = 1;
+    verticesRemovidos++;
 }
 
 void Graph::insertEdge(int v, int w) {
+    if (removido[v] || removido[w]) return;
     if (!hasEdge(v, w)) {
         adj[v].push_back(Edge(v, w));
         numE++;
+        if (directed) grauEntrada[w]++;
         if (!directed && v != w) {
             adj[w].push_back(Edge(w, v));
         }
@@ -47,6 +54,7 @@ void Graph::insertEdge(int v, int w) {
 }
 
 bool Graph::hasEdge(int v, int w) const {
+    if (removido[v] || removido[w]) return false;
     for (const auto& edge : adj[v]) {
         if (edge.w == w) return true;
     }
@@ -55,20 +63,91 @@ bool Graph::hasEdge(int v, int w) const {
 
 bool Graph::edge(int v, int w) { return hasEdge(v, w); }
 
+bool Graph::marcarAresta(int v, int w) {
+    for (auto& e : adj[v]) {
+        if (e.w == w) {
+            e.w = -1;
+            // Lista com mais lápides que arestas: limpa em O(grau), amortizado
+            if (2 * ++lapides[v] > (int)adj[v].size()) limparLista(v);
+            return true;
+        }
+    }
+    return false;
+}
+
+void Graph::limparLista(int v) {
+    auto& lista = adj[v];
+    lista.erase(std::remove_if(lista.begin(), lista.end(), [&](const Edge& e) { return !viva(e); }),
+                lista.end());
+    lapides[v] = 0;
+}
+
 void Graph::removeEdge(int v, int w) {
-    for (auto it = adj[v].begin(); it != adj[v].end(); ++it) {
-        if (it->w == w) {
-            adj[v].erase(it);
-            numE--;
-            break;
+    if (removido[v] || removido[w]) return;
+    if (!marcarAresta(v, w)) return;
+    numE--;
+    if (directed) grauEntrada[w]--;
+    else if (v != w) marcarAresta(w, v);
+}
+
+std::vector<int> Graph::compact() {
+    std::vector<int> novoDe(numV, -1);
+    int vivos = 0;
+    for (int v = 0; v < numV; ++v) {
+        if (!removido[v]) novoDe[v] = vivos++;
+    }
+
+    // novoDe[v] <= v: cada lista desce para uma posição já consumida
+    for (int v = 0; v < numV; ++v) {
+        if (removido[v]) continue;
+        int nv = novoDe[v];
+        limparLista(v);
+        for (auto& e : adj[v]) {
+            e.v = nv;
+            e.w = novoDe[e.w];
+        }
+        if (nv != v) {
+            adj[nv] = std::move(adj[v]);
+            grauEntrada[nv] = grauEntrada[v];
         }
     }
+
+    adj.resize(vivos);
+    removido.assign(vivos, 0);
+    lapides.assign(vivos, 0);
+    grauEntrada.resize(vivos);
+    numV = vivos;
+    verticesRemovidos = 0;
+    return novoDe;
+}
+
+std::vector<int> Graph::compactIfNeeded() {
+    if (verticesRemovidos > limiteCompactacao * numV) return compact();
+    return {};
+}
+
+size_t Graph::memoryUsage() const {
+    size_t bytes = sizeof(*this) + adj.capacity() * sizeof(adj[0]);
+    for (const auto& lista : adj) bytes += lista.capacity() * sizeof(Edge);
+    return bytes + removido.capacity() * sizeof(char) + lapides.capacity() * sizeof(int) +
+           grauEntrada.capacity() * sizeof(int);
+}
+
+// Vértices removidos contam como isolados até compact()
+GraphStats Graph::stats() const {
+    GraphStats s = GraphStats::compute(numV, numE, directed, false, [this](int v, auto&& visitar) {
+        if (removido[v]) return;
+        for (const auto& e : neighbors(v)) visitar(e.w, 0.0);
+    });
+    s.memoryBytes = memoryUsage();
+    return s;
 }
 
 void Graph::print() const {
     for (int v = 0; v < (int)adj.size(); ++v) {
+        if (removido[v]) continue;
         cout << v << ": ";
-        for (const auto& edge : adj[v]) {
+        for (const auto& edge : neighbors(v)) {
             cout << edge.w << " ";
         }
         cout << endl;
@@ -82,13 +161,18 @@ Edge Graph::AdjIterator::begin() {
     return next();
 }
 
+// Pula lápides e arestas para vértices removidos
 Edge Graph::AdjIterator::next() {
-    if (index < (int)G.adj[v].size())
-        return G.adj[v][index++];
-    else
-        return Edge(-1, -1);
+    while (index < (int)G.adj[v].size()) {
+        const Edge& e = G.adj[v][index++];
+        if (G.viva(e)) return e;
+    }
+    return Edge(-1, -1);
 }
 
-bool Graph::AdjIterator::end() {
-    return index >= (int)G.adj[v].size();
+// Só consulta: as lápides restantes são puladas pelo próximo next()
+bool Graph::AdjIterator::end() const {
+    int i = index;
+    while (i < (int)G.adj[v].size() && !G.viva(G.adj[v][i])) i++;
+    return i >= (int)G.adj[v].size();
 }
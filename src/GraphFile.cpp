@@ -0,0 +1,202 @@
+#include "GraphFile.h"
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+const char MAGIC[8] = {'G', 'R', 'A', 'F', 'O', 'C', 'S', 'R'};
+
+struct Cabecalho {
+    char magic[8];
+    uint32_t versao;
+    uint32_t tipoPeso;
+    uint32_t flags;
+    uint32_t reservado;
+    uint64_t numV;
+    uint64_t numE;
+    uint64_t checksum;
+    uint8_t preenchimento[16];
+};
+static_assert(sizeof(Cabecalho) == 64, "cabeçalho do GraphFile deve ter 64 bytes");
+
+const uint32_t FLAG_DIRECIONADO = 1;
+
+template <typename W> constexpr uint32_t codigoPeso();
+template <> constexpr uint32_t codigoPeso<uint16_t>() { return 1; }
+template <> constexpr uint32_t codigoPeso<int32_t>() { return 2; }
+template <> constexpr uint32_t codigoPeso<float>() { return 3; }
+template <> constexpr uint32_t codigoPeso<double>() { return 4; }
+
+uint64_t alinhar8(uint64_t n) { return (n + 7) & ~uint64_t(7); }
+
+// Hash de 64 bits palavra a palavra (multiplicação do FNV), encadeável entre blocos
+uint64_t hashBytes(uint64_t h, const void* dados, uint64_t n) {
+    const unsigned char* p = static_cast<const unsigned char*>(dados);
+    const uint64_t PRIMO = 0x100000001b3ULL;
+    uint64_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        uint64_t palavra;
+        std::memcpy(&palavra, p + i, 8);
+        h = (h ^ palavra) * PRIMO;
+    }
+    for (; i < n; ++i) h = (h ^ p[i]) * PRIMO;
+    return h;
+}
+
+const uint64_t HASH_INICIAL = 0xcbf29ce484222325ULL;
+
+void exigirLittleEndian() {
+    if constexpr (std::endian::native != std::endian::little) {
+        throw std::runtime_error("GraphFile: formato little-endian não suportado nesta arquitetura");
+    }
+}
+
+// Posições dos arrays no arquivo
+struct Layout {
+    uint64_t offOffsets, offTargets, offWeights, tamanho;
+};
+
+template <typename W>
+Layout calcularLayout(uint64_t V, uint64_t E) {
+    Layout l;
+    l.offOffsets = sizeof(Cabecalho);
+    l.offTargets = alinhar8(l.offOffsets + (V + 1) * sizeof(int));
+    l.offWeights = alinhar8(l.offTargets + E * sizeof(int));
+    l.tamanho = l.offWeights + E * sizeof(W);
+    return l;
+}
+
+void escreverPreenchimento(std::ofstream& out, uint64_t ate) {
+    static const char zeros[8] = {};
+    uint64_t pos = (uint64_t)out.tellp();
+    if (ate > pos) out.write(zeros, (std::streamsize)(ate - pos));
+}
+
+// Dono do mapeamento: desfaz o mmap quando a última fotografia é destruída
+struct Mapeamento {
+    void* base;
+    size_t tamanho;
+    Mapeamento(void* base, size_t tamanho) : base(base), tamanho(tamanho) {}
+    Mapeamento(const Mapeamento&) = delete;
+    Mapeamento& operator=(const Mapeamento&) = delete;
+    ~Mapeamento() { munmap(base, tamanho); }
+};
+
+}
+
+template <typename W>
+void GraphFile::write(const std::string& caminho, const BasicCSRGraph<W>& grafo) {
+    exigirLittleEndian();
+    uint64_t V = grafo.V(), E = grafo.E();
+    Layout l = calcularLayout<W>(V, E);
+
+    Cabecalho cab{};
+    std::memcpy(cab.magic, MAGIC, sizeof(MAGIC));
+    cab.versao = VERSAO;
+    cab.tipoPeso = codigoPeso<W>();
+    cab.flags = grafo.isDirected() ? FLAG_DIRECIONADO : 0;
+    cab.numV = V;
+    cab.numE = E;
+    uint64_t h = HASH_INICIAL;
+    h = hashBytes(h, grafo.offsetData(), (V + 1) * sizeof(int));
+    h = hashBytes(h, grafo.targetData(), E * sizeof(int));
+    h = hashBytes(h, grafo.weightData(), E * sizeof(W));
+    cab.checksum = h;
+
+    std::ofstream out(caminho, std::ios::binary | std::ios::trunc);
+    if (!out) throw std::runtime_error("GraphFile: não foi possível criar " + caminho);
+
+    out.write(reinterpret_cast<const char*>(&cab), sizeof(cab));
+    out.write(reinterpret_cast<const char*>(grafo.offsetData()), (std::streamsize)((V + 1) * sizeof(int)));
+    escreverPreenchimento(out, l.offTargets);
+    out.write(reinterpret_cast<const char*>(grafo.targetData()), (std::streamsize)(E * sizeof(int)));
+    escreverPreenchimento(out, l.offWeights);
+    out.write(reinterpret_cast<const char*>(grafo.weightData()), (std::streamsize)(E * sizeof(W)));
+
+    if (!out) throw std::runtime_error("GraphFile: falha ao escrever " + caminho);
+}
+
+template <typename W>
+void GraphFile::write(const std::string& caminho, const BasicWeightedGraph<W>& grafo) {
+    write(caminho, BasicCSRGraph<W>(grafo));
+}
+
+template <typename W>
+BasicCSRGraph<W> GraphFile::map(const std::string& caminho, bool verificarChecksum) {
+    exigirLittleEndian();
+
+    int fd = open(caminho.c_str(), O_RDONLY);
+    if (fd < 0) throw std::runtime_error("GraphFile: não foi possível abrir " + caminho);
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (uint64_t)st.st_size < sizeof(Cabecalho)) {
+        close(fd);
+        throw std::runtime_error("GraphFile: arquivo truncado: " + caminho);
+    }
+
+    size_t tamanho = (size_t)st.st_size;
+    void* base = mmap(nullptr, tamanho, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd); // o mapeamento continua válido sem o descritor
+    if (base == MAP_FAILED) throw std::runtime_error("GraphFile: mmap falhou para " + caminho);
+
+    auto mapeamento = std::make_shared<Mapeamento>(base, tamanho);
+    const char* bytes = static_cast<const char*>(base);
+
+    Cabecalho cab;
+    std::memcpy(&cab, bytes, sizeof(cab));
+    if (std::memcmp(cab.magic, MAGIC, sizeof(MAGIC)) != 0)
+        throw std::runtime_error("GraphFile: não é um arquivo de grafo: " + caminho);
+    if (cab.versao != VERSAO)
+        throw std::runtime_error("GraphFile: versão de formato não suportada em " + caminho);
+    if (cab.tipoPeso != codigoPeso<W>())
+        throw std::runtime_error("GraphFile: tipo de peso do arquivo difere do pedido em " + caminho);
+    if (cab.numV > (uint64_t)INT32_MAX || cab.numE > (uint64_t)INT32_MAX)
+        throw std::runtime_error("GraphFile: grafo grande demais para índices de 32 bits: " + caminho);
+
+    Layout l = calcularLayout<W>(cab.numV, cab.numE);
+    if (l.tamanho > tamanho)
+        throw std::runtime_error("GraphFile: arquivo truncado: " + caminho);
+
+    const int* offsets = reinterpret_cast<const int*>(bytes + l.offOffsets);
+    const int* targets = reinterpret_cast<const int*>(bytes + l.offTargets);
+    const W* weights = reinterpret_cast<const W*>(bytes + l.offWeights);
+
+    // O(1), sempre: extremos dos offsets coerentes com o cabeçalho
+    int numV = (int)cab.numV, numE = (int)cab.numE;
+    if (offsets[0] != 0 || offsets[numV] != numE)
+        throw std::runtime_error("GraphFile: offsets inconsistentes com o cabeçalho em " + caminho);
+
+    if (verificarChecksum) {
+        // O(V + E): um checksum válido não garante offsets monótonos nem alvos em [0, V)
+        for (int v = 0; v < numV; ++v) {
+            if (offsets[v] > offsets[v + 1])
+                throw std::runtime_error("GraphFile: offsets decrescentes em " + caminho);
+        }
+        for (int e = 0; e < numE; ++e) {
+            if (targets[e] < 0 || targets[e] >= numV)
+                throw std::runtime_error("GraphFile: vértice de destino fora do intervalo em " + caminho);
+        }
+
+        uint64_t h = HASH_INICIAL;
+        h = hashBytes(h, offsets, (cab.numV + 1) * sizeof(int));
+        h = hashBytes(h, targets, cab.numE * sizeof(int));
+        h = hashBytes(h, weights, cab.numE * sizeof(W));
+        if (h != cab.checksum)
+            throw std::runtime_error("GraphFile: checksum inválido em " + caminho);
+    }
+
+    return BasicCSRGraph<W>(numV, numE, (cab.flags & FLAG_DIRECIONADO) != 0,
+                            offsets, targets, weights, std::move(mapeamento));
+}
+
+#define INSTANCIAR_GRAPHFILE(W) \
+    template void GraphFile::write(const std::string&, const BasicCSRGraph<W>&); \
+    template void GraphFile::write(const std::string&, const BasicWeightedGraph<W>&); \
+    template BasicCSRGraph<W> GraphFile::map(const std::string&, bool);
+FOR_EACH_WEIGHT_TYPE(INSTANCIAR_GRAPHFILE)
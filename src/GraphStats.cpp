@@ -0,0 +1,13 @@
+#include "GraphStats.h"
+
+void GraphStats::print(std::ostream& out) const {
+    out << "   -> Grafo: " << numVertices << " vertices, " << numEdges << " arestas ("
+        << (directed ? "direcionado" : "nao-direcionado") << "), "
+        << memoryBytes / 1024.0 << " KiB" << std::endl;
+    out << "   -> Grau: min " << minDegree << ", medio " << meanDegree << ", max " << maxDegree
+        << " (p50 " << p50Degree << ", p90 " << p90Degree << ", p99 " << p99Degree << "), "
+        << isolatedVertices << " isolados" << std::endl;
+    out << "   -> Lacos: " << selfLoops << ", arestas paralelas: " << parallelEdges;
+    if (weighted) out << ", pesos em [" << minWeight << ", " << maxWeight << "]";
+    out << std::endl;
+}
@@ -2,10 +2,17 @@
 
 // Includes dos algoritmos
 #include "WeightedGraph.h"
+#include "CSRGraph.h"
+#include "ImplicitGridGraph.h"
 #include "KruskalMST.h"
+#include "BoruvkaMST.h"
+#include "PrimMST.h"
+#include "StrategyRunner.h"
 #include "EdmondsMST.h"
 #include "TarjanMST.h"
 #include "GabowMST.h"
+#include "SpanningResult.h"
+#include "VertexOrdering.h"
 
 // Definições do STB Image
 #define STB_IMAGE_IMPLEMENTATION
@@ -16,17 +23,20 @@
 #include <iostream>
 #include <vector>
 #include <cmath>
-#include <queue>
 #include <map>
-#include <set>
 #include <algorithm>
 #include <tuple>
 #include <chrono>
+#include <memory_resource>
+#include <optional>
 
 using namespace std;
 
 // --- Estruturas Auxiliares Locais ---
 
+// Distâncias redmean ficam abaixo de ~800: float basta e ocupa metade de um double
+using PesoAresta = float;
+
 struct Pixel { unsigned char r, g, b; };
 
 // DSU Local para a etapa de pré-processamento (Superpixels)
@@ -49,28 +59,11 @@ struct DSU_Pre {
 
 // --- Métodos de Ajuda com Melhoria Perceptual (Redmean) ---
 
-// Fórmula Redmean: muito melhor que Euclideana simples para o olho humano
-double getRedmeanDiff(long r1, long g1, long b1, long r2, long g2, long b2) {
-    long rmean = (r1 + r2) / 2;
-    long r = r1 - r2;
-    long g = g1 - g2;
-    long b = b1 - b2;
-    return sqrt( (((512+rmean)*r*r)>>8) + 4*g*g + (((767-rmean)*b*b)>>8) );
-}
-
-// Wrapper para acessar bytes brutos da imagem
-double getPixelDiff(const unsigned char* img, int idx1, int idx2, int channels) {
-    int p1 = idx1 * channels;
-    int p2 = idx2 * channels;
-    return getRedmeanDiff(img[p1], img[p1+1], img[p1+2], 
-                          img[p2], img[p2+1], img[p2+2]);
-}
-
 // Wrapper para tuplas (usado no grafo principal)
 double getColorDiff(const tuple<int,int,int>& c1, const tuple<int,int,int>& c2) {
     auto [r1, g1, b1] = c1;
     auto [r2, g2, b2] = c2;
-    return getRedmeanDiff(r1, g1, b1, r2, g2, b2);
+    return redmeanDistance(r1, g1, b1, r2, g2, b2);
 }
 
 // Suavização Gaussiana 5x5 (Melhor que a média simples)
@@ -141,18 +134,11 @@ void ImageSegmentation::runSegmentation(const string& inputPath, const string& o
     // Usa o valor definido nas opções ou um padrão seguro
     double preThreshold = (options.minSuperpixelSize > 0) ? options.minSuperpixelSize : 40.0;
 
-    // Conecta vizinhos muito similares
-    for (int y = 0; y < h; ++y) {
-        for (int x = 0; x < w; ++x) {
-            int u = y * w + x;
-            if (x + 1 < w) {
-                int v = y * w + (x + 1);
-                if (getPixelDiff(img, u, v, ch) < preThreshold) dsu.unite(u, v);
-            }
-            if (y + 1 < h) {
-                int v = (y + 1) * w + x;
-                if (getPixelDiff(img, u, v, ch) < preThreshold) dsu.unite(u, v);
-            }
+    // Conecta vizinhos muito similares (grade implícita: pesos lidos direto do buffer)
+    ImplicitGridGraph<RedmeanPixelWeight> grade(w, h, RedmeanPixelWeight(img, ch));
+    for (int u = 0; u < numPixels; ++u) {
+        for (const auto& e : grade.forwardNeighbors(u)) {
+            if (e.weight < preThreshold) dsu.unite(u, e.w);
         }
     }
 
@@ -161,6 +147,7 @@ void ImageSegmentation::runSegmentation(const string& inputPath, const string& o
     vector<int> pixelToSuper(numPixels);
     vector<long long> sumR(numPixels, 0), sumG(numPixels, 0), sumB(numPixels, 0);
     vector<int> countP(numPixels, 0);
+    vector<long long> sumX(numPixels, 0), sumY(numPixels, 0);
     int nextSuperId = 0;
 
     for (int i = 0; i < numPixels; ++i) {
@@ -176,13 +163,18 @@ void ImageSegmentation::runSegmentation(const string& inputPath, const string& o
         sumG[sId] += img[idx+1]; 
         sumB[sId] += img[idx+2];
         countP[sId]++;
+        sumX[sId] += i % w;
+        sumY[sId] += i / w;
     }
 
     int numSupernodes = nextSuperId;
     vector<tuple<int,int,int>> superColors(numSupernodes);
+    vector<pair<double,double>> centroides(numSupernodes);
     for(int i=0; i<numSupernodes; ++i) {
-        if(countP[i] > 0)
+        if(countP[i] > 0) {
             superColors[i] = { sumR[i]/countP[i], sumG[i]/countP[i], sumB[i]/countP[i] };
+            centroides[i] = { (double)sumX[i]/countP[i], (double)sumY[i]/countP[i] };
+        }
     }
 
     cout << "   -> Reduzido de " << numPixels << " pixels para " << numSupernodes << " superpixels." << endl;
@@ -191,9 +183,11 @@ void ImageSegmentation::runSegmentation(const string& inputPath, const string& o
     cout << "3. Construindo Grafo de Adjacencia..." << endl;
     auto start = chrono::high_resolution_clock::now();
 
-    bool directed = (strategy != Strategy::KRUSKAL_MST);
-    WeightedGraph graph(numSupernodes, directed);
-    set<pair<int,int>> edgesAdded;
+    bool directed = (strategy == Strategy::EDMONDS_MSA || strategy == Strategy::TARJAN_MSA ||
+                     strategy == Strategy::GABOW_MSA);
+    // Arena da execução: as listas de adjacência são liberadas juntas ao fim da função
+    std::pmr::monotonic_buffer_resource arenaGrafo;
+    vector<BasicWeightedEdge<PesoAresta>> arestasRAG;
 
     int dx[] = {1, 0, -1, 0};
     int dy[] = {0, 1, 0, -1};
@@ -212,77 +206,120 @@ void ImageSegmentation::runSegmentation(const string& inputPath, const string& o
                     int vSuper = pixelToSuper[vPix];
 
                     if (uSuper != vSuper) {
-                        if (edgesAdded.find({uSuper, vSuper}) == edgesAdded.end()) {
-                            double w = getColorDiff(superColors[uSuper], superColors[vSuper]);
-                            graph.insertEdge(uSuper, vSuper, w);
-                            edgesAdded.insert({uSuper, vSuper});
-                        }
+                        PesoAresta w = (PesoAresta)getColorDiff(superColors[uSuper], superColors[vSuper]);
+                        arestasRAG.push_back(BasicWeightedEdge<PesoAresta>(uSuper, vSuper, w));
                     }
                 }
             }
         }
     }
 
-    // --- ETAPA D: Algoritmo MST/MSA ---
-    cout << "4. Executando Algoritmo..." << endl;
-    WeightedGraph resultGraph(numSupernodes, directed);
     int root = 0; 
 
-    if (strategy == Strategy::KRUSKAL_MST) {
-        resultGraph = KruskalMST::obterArvoreGeradoraMinima(graph);
-    } 
-    else if (strategy == Strategy::EDMONDS_MSA) {
-        resultGraph = EdmondsMST::obterArborescencia(graph, root);
+    // Renumeração dos superpixels para localidade de cache (ver VertexOrdering);
+    // o resultado volta aos rótulos originais antes da pintura
+    VertexPermutation ordem;
+    bool reordenar = options.ordering != Ordering::ORIGINAL;
+    if (reordenar) {
+        if (options.ordering == Ordering::HILBERT) {
+            ordem = VertexOrdering::hilbert(centroides);
+        } else {
+            ordem = VertexOrdering::compute<PesoAresta>(numSupernodes, arestasRAG, directed, options.ordering);
+        }
+        ordem.relabel<PesoAresta>(arestasRAG);
+        root = ordem.toNew(root);
+    }
+
+    // RAG não-direcionado com cada fronteira guardada uma vez (repetidas removidas em lote),
+    // ou CSR montado em paralelo direto das fronteiras (repetidas entre os mesmos
+    // superpixels combinadas na montagem) para os algoritmos de arborescência
+    optional<BasicUndirectedGraph<PesoAresta>> rag;
+    optional<BasicCSRGraph<PesoAresta>> csr;
+    if (!directed) {
+        rag.emplace(numSupernodes, &arenaGrafo);
+        rag->insertEdges(arestasRAG, DuplicatePolicy::KEEP_FIRST);
+    } else {
+        csr.emplace(BasicCSRGraph<PesoAresta>::fromEdges(numSupernodes, arestasRAG, directed,
+                                                         DuplicatePolicy::KEEP_FIRST));
     }
-    else if (strategy == Strategy::TARJAN_MSA) {
-        resultGraph = TarjanMST::obterArborescencia(graph, root);
+
+    // Forma do grafo ao fim da etapa C; o cálculo e a impressão ficam fora do tempo medido
+    auto inicioStats = chrono::high_resolution_clock::now();
+    (rag ? rag->stats() : csr->stats()).print();
+    chrono::duration<double> tempoStats = chrono::high_resolution_clock::now() - inicioStats;
+
+    // --- ETAPA D: Algoritmo MST/MSA ---
+    cout << "4. Executando Algoritmo..." << endl;
+
+    // Resultado como vetor de pais: nenhum WeightedGraph intermediário é construído
+    BasicSpanningResult<PesoAresta> resultado;
+    // Kruskal: os segmentos saem direto como rótulos, sem árvore
+    ComponentLabels componentes;
+
+    if (rag) {
+        if (strategy == Strategy::AUTO_MST) {
+            strategy = StrategyRunner::resolve(*rag, strategy);
+            cout << "   -> Motor automatico: " << StrategyRunner::name(strategy) << endl;
+        }
+
+        if (strategy == Strategy::KRUSKAL_MST) {
+            // Cortar a MST em `threshold` dá as componentes das arestas <= threshold: o Kruskal
+            // em modo limiar só une essas arestas, sem ordenar nem montar o vetor de pais
+            componentes = KruskalMST::obterComponentesAteLimiar(*rag, threshold);
+        }
+        else if (strategy == Strategy::BORUVKA_MST) {
+            // Floresta mínima completa em rodadas paralelas; o corte no threshold fica para a etapa E
+            resultado = BoruvkaMST::obterFlorestaGeradora(*rag);
+        }
+        else if (strategy == Strategy::PRIM_MST) {
+            resultado = PrimMST::obterFlorestaGeradora(*rag);
+        }
     }
-    else if (strategy == Strategy::GABOW_MSA) {
-        resultGraph = GabowMST::obterArborescencia(graph, root);
+    else {
+        if (strategy == Strategy::EDMONDS_MSA) {
+            resultado = EdmondsMST::obterPaisArborescencia(*csr, root);
+        }
+        else if (strategy == Strategy::TARJAN_MSA) {
+            resultado = TarjanMST::obterPaisArborescencia(*csr, root);
+        }
+        else if (strategy == Strategy::GABOW_MSA) {
+            resultado = GabowMST::obterPaisArborescencia(*csr, root);
+        }
     }
 
+    if (reordenar && strategy != Strategy::KRUSKAL_MST) resultado = ordem.restore(resultado);
+
     auto end = chrono::high_resolution_clock::now();
-    chrono::duration<double> elapsed = end - start;
+    chrono::duration<double> elapsed = end - start - tempoStats;
     cout << "   -> Tempo Algoritmo: " << elapsed.count() << "s" << endl;
 
     // --- ETAPA E: Segmentação e Pintura (Average Color) ---
     cout << "5. Gerando Imagem Final..." << endl;
     
-    // Lista de adjacência baseada no threshold final
-    vector<vector<int>> adj(numSupernodes);
-    for(int i=0; i<numSupernodes; ++i) {
-        WeightedGraph::AdjIterator it(resultGraph, i);
-        WeightedEdge e = it.begin();
-        while(e.v != -1) {
-            if (e.weight <= threshold) {
-                adj[e.v].push_back(e.w);
-                adj[e.w].push_back(e.v);
-            }
-            if(it.end()) break;
-            e = it.next();
+    // Segmento provisório de cada superpixel (rótulo do Kruskal ou raiz no DSU)
+    vector<int> provisorio(numSupernodes);
+    if (strategy == Strategy::KRUSKAL_MST) {
+        for (int i = 0; i < numSupernodes; ++i) {
+            provisorio[i] = componentes.label[reordenar ? ordem.toNew(i) : i];
         }
+    } else {
+        // Componentes das arestas da árvore com peso <= threshold (segmentos finais)
+        DSU_Pre segmentos(numSupernodes);
+        for (int v = 0; v < numSupernodes; ++v) {
+            int p = resultado.parent[v];
+            if (p != -1 && resultado.parentWeight[v] <= threshold) segmentos.unite(v, p);
+        }
+        for (int i = 0; i < numSupernodes; ++i) provisorio[i] = segmentos.find(i);
     }
 
-    // BFS para identificar componentes conexos (segmentos finais)
+    // Numeração na ordem do menor superpixel de cada segmento
+    vector<int> segmentOfRoot(numSupernodes, -1);
     vector<int> superToSegment(numSupernodes, -1);
     int segmentCount = 0;
-    
-    for(int i=0; i<numSupernodes; ++i) {
-        if(superToSegment[i] == -1) {
-            queue<int> q;
-            q.push(i);
-            superToSegment[i] = segmentCount;
-            while(!q.empty()) {
-                int u = q.front(); q.pop();
-                for(int v : adj[u]) {
-                    if(superToSegment[v] == -1) {
-                        superToSegment[v] = segmentCount;
-                        q.push(v);
-                    }
-                }
-            }
-            segmentCount++;
-        }
+    for (int i = 0; i < numSupernodes; ++i) {
+        int r = provisorio[i];
+        if (segmentOfRoot[r] == -1) segmentOfRoot[r] = segmentCount++;
+        superToSegment[i] = segmentOfRoot[r];
     }
 
     // --- MELHORIA VISUAL: Pintar com a cor média do segmento ---
@@ -1,5 +1,8 @@
 #include "KruskalMST.h"
+#include "EdgeSort.h"
+#include "Parallel.h"
 #include <algorithm>
+#include <span>
 #include <vector>
 #include <iostream>
 
@@ -21,6 +24,13 @@ struct ConjuntoDisjunto {
         return pai[v];
     }
 
+    // Busca sem compressão: só lê pai[], então várias threads podem chamá-la
+    // enquanto ninguém une (a união por rank mantém a altura em O(log n))
+    int raiz(int v) const {
+        while (v != pai[v]) v = pai[v];
+        return v;
+    }
+
     void unir(int v1, int v2) {
         int raiz1 = buscar(v1);
         int raiz2 = buscar(v2);
@@ -38,47 +48,338 @@ struct ConjuntoDisjunto {
     }
 };
 
-WeightedGraph KruskalMST::obterArvoreGeradoraMinima(WeightedGraph& grafoEntrada) {
+// Enraíza cada árvore da floresta no seu menor vértice (BFS sobre adjacência plana)
+template <typename W>
+static void orientarFloresta(int numVertices, const std::vector<BasicWeightedEdge<W>>& escolhidas,
+                             BasicSpanningForestResult<W>& resultado) {
+    std::vector<int> offsets(numVertices + 1, 0);
+    for (const auto& a : escolhidas) {
+        offsets[a.v + 1]++;
+        offsets[a.w + 1]++;
+    }
+    for (int v = 0; v < numVertices; ++v) offsets[v + 1] += offsets[v];
+
+    std::vector<int> vizinhos(offsets[numVertices]);
+    std::vector<W> pesos(offsets[numVertices]);
+    std::vector<int> pos(offsets.begin(), offsets.end() - 1);
+    for (const auto& a : escolhidas) {
+        vizinhos[pos[a.v]] = a.w; pesos[pos[a.v]++] = a.weight;
+        vizinhos[pos[a.w]] = a.v; pesos[pos[a.w]++] = a.weight;
+    }
+
+    std::vector<char> visitado(numVertices, 0);
+    std::vector<int> fila(numVertices);
+    for (int s = 0; s < numVertices; ++s) {
+        if (visitado[s]) continue;
+        visitado[s] = 1;
+        int ini = 0, fim = 0;
+        fila[fim++] = s;
+        while (ini < fim) {
+            int u = fila[ini++];
+            for (int i = offsets[u]; i < offsets[u + 1]; ++i) {
+                int v = vizinhos[i];
+                if (visitado[v]) continue;
+                visitado[v] = 1;
+                resultado.parent[v] = u;
+                resultado.parentWeight[v] = pesos[i];
+                fila[fim++] = v;
+            }
+        }
+    }
+}
+
+/**
+ * Filter-Kruskal: particiona as arestas em torno de um pivô de peso, resolve a metade
+ * leve, descarta da metade pesada as arestas cujas pontas já estão conectadas e só
+ * então desce nela. Em grafos densos a maior parte das arestas pesadas é filtrada sem
+ * nunca ser ordenada. Partição e filtro são estáveis, então as arestas chegam ao
+ * conjunto disjunto na mesma ordem (peso, posição) da ordenação completa e a floresta
+ * é idêntica à do Kruskal simples.
+ */
+template <typename W>
+struct FiltroKruskal {
+    using Aresta = BasicWeightedEdge<W>;
+
+    // Abaixo do corte a faixa é ordenada (EdgeSort) e percorrida direto
+    static constexpr size_t CORTE = 1 << 12;
+    // Blocos de partição/filtro; faixas com um bloco só rodam na thread atual
+    static constexpr size_t BLOCO = 1 << 14;
+    static constexpr int AMOSTRA = 63;
+
+    int numVertices;
+    ConjuntoDisjunto ds;
+    std::vector<Aresta> escolhidas;
+    std::vector<Aresta> auxiliar;
+    std::vector<size_t> mantidasPorBloco;
+
+    FiltroKruskal(int n, size_t numArestas) : numVertices(n), ds(n), auxiliar(numArestas) {
+        escolhidas.reserve(n > 0 ? n - 1 : 0);
+    }
+
+    bool completa() const { return (int)escolhidas.size() >= numVertices - 1; }
+
+    void percorrer(std::span<const Aresta> ordenadas) {
+        for (const auto& aresta : ordenadas) {
+            if (ds.buscar(aresta.v) != ds.buscar(aresta.w)) {
+                ds.unir(aresta.v, aresta.w);
+                escolhidas.push_back(aresta);
+                if (completa()) return;
+            }
+        }
+    }
+
+    // Partição estável em paralelo: cada bloco conta as suas mantidas, um prefixo dá
+    // o destino de cada bloco e o espalhamento preserva a ordem dentro das duas metades.
+    // Devolve quantas arestas ficaram na frente.
+    template <typename Pred>
+    size_t particionar(std::span<Aresta> faixa, Pred manter) {
+        size_t n = faixa.size();
+        size_t numBlocos = (n + BLOCO - 1) / BLOCO;
+        mantidasPorBloco.assign(numBlocos + 1, 0);
+
+        Parallel::forRange(0, (long long)numBlocos, [&](long long a, long long b, int) {
+            for (long long k = a; k < b; ++k) {
+                size_t fim = std::min(n, (size_t)(k + 1) * BLOCO), c = 0;
+                for (size_t i = (size_t)k * BLOCO; i < fim; ++i) c += manter(faixa[i]) ? 1 : 0;
+                mantidasPorBloco[k + 1] = c;
+            }
+        }, 1);
+        for (size_t k = 0; k < numBlocos; ++k) mantidasPorBloco[k + 1] += mantidasPorBloco[k];
+        size_t totalMantidas = mantidasPorBloco[numBlocos];
+
+        Parallel::forRange(0, (long long)numBlocos, [&](long long a, long long b, int) {
+            for (long long k = a; k < b; ++k) {
+                size_t ini = (size_t)k * BLOCO, fim = std::min(n, ini + BLOCO);
+                size_t frente = mantidasPorBloco[k];
+                size_t tras = totalMantidas + (ini - mantidasPorBloco[k]);
+                for (size_t i = ini; i < fim; ++i) {
+                    if (manter(faixa[i])) auxiliar[frente++] = faixa[i];
+                    else auxiliar[tras++] = faixa[i];
+                }
+            }
+        }, 1);
+        Parallel::forRange(0, (long long)numBlocos, [&](long long a, long long b, int) {
+            size_t ini = (size_t)a * BLOCO, fim = std::min(n, (size_t)b * BLOCO);
+            std::copy(auxiliar.begin() + ini, auxiliar.begin() + fim, faixa.begin() + ini);
+        }, 1);
+        return totalMantidas;
+    }
+
+    // Mediana de uma amostra espaçada da faixa
+    static W escolherPivo(std::span<const Aresta> faixa) {
+        W amostra[AMOSTRA];
+        for (int i = 0; i < AMOSTRA; ++i) amostra[i] = faixa[faixa.size() * i / AMOSTRA].weight;
+        std::nth_element(amostra, amostra + AMOSTRA / 2, amostra + AMOSTRA);
+        return amostra[AMOSTRA / 2];
+    }
+
+    void resolver(std::span<Aresta> faixa) {
+        if (faixa.empty() || completa()) return;
+        if (faixa.size() > CORTE) {
+            W pivo = escolherPivo(faixa);
+            size_t leves = particionar(faixa, [pivo](const Aresta& a) { return !(pivo < a.weight); });
+            // Pivô no peso máximo (muitos empates): nada a separar, ordena a faixa inteira
+            if (leves < faixa.size()) {
+                resolver(faixa.first(leves));
+                if (completa()) return;
+                std::span<Aresta> pesadas = faixa.subspan(leves);
+                size_t restantes = particionar(pesadas, [this](const Aresta& a) { return ds.raiz(a.v) != ds.raiz(a.w); });
+                resolver(pesadas.first(restantes));
+                return;
+            }
+        }
+        EdgeSort::byWeight<W>(faixa);
+        percorrer(faixa);
+    }
+};
+
+template <typename W>
+BasicSpanningForestResult<W> KruskalMST::enraizarFloresta(int numVertices, const std::vector<BasicWeightedEdge<W>>& escolhidas) {
+    BasicSpanningForestResult<W> resultado(numVertices, -1, false);
+    orientarFloresta(numVertices, escolhidas, resultado);
+    return resultado;
+}
+
+template <typename W>
+BasicSpanningForestResult<W> KruskalMST::construirFloresta(int numVertices, std::vector<BasicWeightedEdge<W>>& listaArestas) {
+    // Filter-Kruskal; as faixas pequenas usam contagem ou radix quando a faixa de
+    // pesos permite (ver EdgeSort)
+    FiltroKruskal<W> filtro(numVertices, listaArestas.size());
+    filtro.resolver(listaArestas);
+
+    BasicSpanningForestResult<W> resultado(numVertices, -1, false);
+    orientarFloresta(numVertices, filtro.escolhidas, resultado);
+    return resultado;
+}
+
+template <typename W>
+BasicSpanningForestResult<W> KruskalMST::obterFlorestaGeradora(const BasicWeightedGraph<W>& grafoEntrada) {
+    int numVertices = grafoEntrada.V();
+
+    std::vector<BasicWeightedEdge<W>> listaArestas;
+    listaArestas.reserve(grafoEntrada.E());
+
+    for (const auto& aresta : grafoEntrada.edges()) {
+        if (aresta.v < aresta.w) {
+            listaArestas.push_back(aresta);
+        }
+    }
+
+    BasicSpanningForestResult<W> resultado = construirFloresta(numVertices, listaArestas);
+    resultado.locateEdges(grafoEntrada);
+    return resultado;
+}
+
+template <typename W>
+BasicSpanningForestResult<W> KruskalMST::obterFlorestaGeradora(const BasicCSRGraph<W>& grafoEntrada) {
     int numVertices = grafoEntrada.V();
-    
-    WeightedGraph mst(numVertices, false);
-
-    std::vector<WeightedEdge> listaArestas;
-    
-    for (int i = 0; i < numVertices; ++i) {
-        WeightedGraph::AdjIterator it(grafoEntrada, i);
-        
-        WeightedEdge aresta = it.begin();
-        while (true) {
-            if (aresta.v == -1) break;
-
-            if (aresta.v < aresta.w) {
-                listaArestas.push_back(aresta);
+
+    std::vector<BasicWeightedEdge<W>> listaArestas;
+    listaArestas.reserve(grafoEntrada.E() / 2);
+
+    for (int u = 0; u < numVertices; ++u) {
+        for (int e = grafoEntrada.firstEdge(u); e < grafoEntrada.lastEdge(u); ++e) {
+            int v = grafoEntrada.target(e);
+            if (u < v) {
+                listaArestas.push_back(BasicWeightedEdge<W>(u, v, grafoEntrada.weight(e)));
             }
-            
-            if (it.end()) break;
-            aresta = it.next();
         }
     }
 
-    std::sort(listaArestas.begin(), listaArestas.end(), 
-        [](const WeightedEdge& a, const WeightedEdge& b) {
-            return a.weight < b.weight;
-        });
+    BasicSpanningForestResult<W> resultado = construirFloresta(numVertices, listaArestas);
+    resultado.locateEdges(grafoEntrada);
+    return resultado;
+}
+
+// Cada aresta já está uma vez no array do grafo: ordena no lugar, sem lista auxiliar
+template <typename W>
+BasicSpanningForestResult<W> KruskalMST::obterFlorestaGeradoraNoLugar(BasicUndirectedGraph<W>& grafoEntrada) {
+    grafoEntrada.sortEdgesByWeight();
+
+    // Já ordenadas: só a passada pelo conjunto disjunto, sem partição (nem buffer auxiliar)
+    FiltroKruskal<W> filtro(grafoEntrada.V(), 0);
+    filtro.percorrer(grafoEntrada.edges());
+
+    BasicSpanningForestResult<W> resultado(grafoEntrada.V(), -1, false);
+    orientarFloresta(grafoEntrada.V(), filtro.escolhidas, resultado);
+    resultado.locateEdges(grafoEntrada);
+    return resultado;
+}
+
+template <typename W>
+BasicSpanningForestResult<W> KruskalMST::obterFlorestaGeradora(const BasicUndirectedGraph<W>& grafoEntrada) {
+    std::vector<BasicWeightedEdge<W>> listaArestas(grafoEntrada.edges().begin(), grafoEntrada.edges().end());
+
+    BasicSpanningForestResult<W> resultado = construirFloresta(grafoEntrada.V(), listaArestas);
+    resultado.locateEdges(grafoEntrada);
+    return resultado;
+}
+
+template <typename W>
+BasicSpanningForestResult<W> KruskalMST::obterFlorestaGeradora(const BasicCompressedGraph<W>& grafoEntrada,
+                                                               size_t arestasPorPassada) {
+    int numVertices = grafoEntrada.V();
+    size_t limite = std::max<size_t>(arestasPorPassada, 1);
+
+    // Candidata: aresta decodificada e sua posição em edges(), que desfaz os empates
+    struct Candidata {
+        BasicWeightedEdge<W> aresta;
+        int pos;
+    };
+    auto precede = [](const Candidata& a, const Candidata& b) {
+        return a.aresta.weight < b.aresta.weight ||
+               (!(b.aresta.weight < a.aresta.weight) && a.pos < b.pos);
+    };
 
     ConjuntoDisjunto ds(numVertices);
-    int arestasAdicionadas = 0;
+    std::vector<BasicWeightedEdge<W>> escolhidas;
+    escolhidas.reserve(numVertices > 0 ? numVertices - 1 : 0);
+    std::vector<Candidata> buffer;
+    bool temUltima = false;
+    Candidata ultima{};
 
-    for (const auto& aresta : listaArestas) {
-        int u = aresta.v;
-        int v = aresta.w;
+    // Cada passada decodifica os cursores e guarda só as `limite` candidatas mais leves
+    // ainda entre componentes diferentes e depois da última chave processada; ordenadas
+    // e unidas, elas avançam a fronteira. Sem corte, a passada viu todas e termina
+    while ((int)escolhidas.size() < numVertices - 1) {
+        buffer.clear();
+        bool cortado = false;
+        Candidata corte{};
+        int pos = -1;
+        for (const auto& aresta : grafoEntrada.edges()) {
+            ++pos;
+            if (!(aresta.v < aresta.w)) continue;
+            Candidata c{aresta, pos};
+            if (temUltima && !precede(ultima, c)) continue;
+            if (cortado && !precede(c, corte)) continue;
+            if (ds.buscar(aresta.v) == ds.buscar(aresta.w)) continue;
+            buffer.push_back(c);
+            if (buffer.size() >= 2 * limite) {
+                // Descarta a metade pesada; os cortes só diminuem
+                std::nth_element(buffer.begin(), buffer.begin() + (limite - 1), buffer.end(), precede);
+                corte = buffer[limite - 1];
+                cortado = true;
+                buffer.resize(limite);
+            }
+        }
+        if (buffer.empty()) break;
 
-        if (ds.buscar(u) != ds.buscar(v)) {
-            ds.unir(u, v);
-            mst.insertEdge(u, v, aresta.weight);
-            arestasAdicionadas++;
+        std::sort(buffer.begin(), buffer.end(), precede);
+        for (const Candidata& c : buffer) {
+            if (ds.buscar(c.aresta.v) != ds.buscar(c.aresta.w)) {
+                ds.unir(c.aresta.v, c.aresta.w);
+                escolhidas.push_back(c.aresta);
+                if ((int)escolhidas.size() == numVertices - 1) break;
+            }
         }
+        ultima = buffer.back();
+        temUltima = true;
+        if (!cortado) break;
+    }
+
+    BasicSpanningForestResult<W> resultado = enraizarFloresta(numVertices, escolhidas);
+    resultado.locateEdges(grafoEntrada);
+    return resultado;
+}
+
+template <typename W>
+ComponentLabels KruskalMST::obterComponentesAteLimiar(const BasicUndirectedGraph<W>& grafoEntrada, double limiar) {
+    int numVertices = grafoEntrada.V();
+    ConjuntoDisjunto ds(numVertices);
+    for (const auto& aresta : grafoEntrada.edges()) {
+        if (aresta.weight <= limiar) ds.unir(aresta.v, aresta.w);
     }
 
-    return mst;
-}
\ No newline at end of file
+    ComponentLabels componentes;
+    componentes.label.assign(numVertices, -1);
+    std::vector<int> rotuloDaRaiz(numVertices, -1);
+    for (int v = 0; v < numVertices; ++v) {
+        int r = ds.buscar(v);
+        if (rotuloDaRaiz[r] == -1) rotuloDaRaiz[r] = componentes.count++;
+        componentes.label[v] = rotuloDaRaiz[r];
+    }
+    return componentes;
+}
+
+template <typename W>
+BasicWeightedGraph<W> KruskalMST::obterArvoreGeradoraMinima(const BasicWeightedGraph<W>& grafoEntrada) {
+    return obterFlorestaGeradora(grafoEntrada).toWeightedGraph();
+}
+
+template <typename W>
+BasicWeightedGraph<W> KruskalMST::obterArvoreGeradoraMinima(const BasicCSRGraph<W>& grafoEntrada) {
+    return obterFlorestaGeradora(grafoEntrada).toWeightedGraph();
+}
+
+#define INSTANCIAR_KRUSKAL(W) \
+    template BasicWeightedGraph<W> KruskalMST::obterArvoreGeradoraMinima(const BasicWeightedGraph<W>&); \
+    template BasicWeightedGraph<W> KruskalMST::obterArvoreGeradoraMinima(const BasicCSRGraph<W>&); \
+    template BasicSpanningForestResult<W> KruskalMST::obterFlorestaGeradora(const BasicWeightedGraph<W>&); \
+    template BasicSpanningForestResult<W> KruskalMST::obterFlorestaGeradora(const BasicCSRGraph<W>&); \
+    template BasicSpanningForestResult<W> KruskalMST::obterFlorestaGeradoraNoLugar(BasicUndirectedGraph<W>&); \
+    template BasicSpanningForestResult<W> KruskalMST::obterFlorestaGeradora(const BasicUndirectedGraph<W>&); \
+    template BasicSpanningForestResult<W> KruskalMST::obterFlorestaGeradora(const BasicCompressedGraph<W>&, size_t); \
+    template ComponentLabels KruskalMST::obterComponentesAteLimiar(const BasicUndirectedGraph<W>&, double); \
+    template BasicSpanningForestResult<W> KruskalMST::enraizarFloresta(int, const std::vector<BasicWeightedEdge<W>>&); \
+    template BasicSpanningForestResult<W> KruskalMST::construirFloresta(int, std::vector<BasicWeightedEdge<W>>&);
+FOR_EACH_WEIGHT_TYPE(INSTANCIAR_KRUSKAL)
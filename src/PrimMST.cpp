@@ -0,0 +1,189 @@
+#include "PrimMST.h"
+#include "KruskalMST.h"
+#include <span>
+#include <vector>
+
+// Heap D-ário indexado por vértice: posicao[] permite diminuir a chave de um vértice
+// já no heap. Com D = 4 a altura cai pela metade em relação ao binário e os filhos de
+// um nó ficam contíguos
+template <int D, typename Menor>
+struct HeapIndexado {
+    std::vector<int> itens;
+    std::vector<int> posicao;   // -1 fora do heap
+    Menor menor;
+
+    HeapIndexado(int n, Menor m) : posicao(n, -1), menor(m) {}
+
+    bool vazio() const { return itens.empty(); }
+    bool contem(int v) const { return posicao[v] != -1; }
+
+    void inserir(int v) {
+        itens.push_back(v);
+        subir((int)itens.size() - 1);
+    }
+
+    // A chave de v diminuiu (quem compara é `menor`)
+    void diminuir(int v) { subir(posicao[v]); }
+
+    int extrairMinimo() {
+        int topo = itens[0];
+        posicao[topo] = -1;
+        int ultimo = itens.back();
+        itens.pop_back();
+        if (!itens.empty()) {
+            itens[0] = ultimo;
+            descer(0);
+        }
+        return topo;
+    }
+
+    void subir(int i) {
+        int v = itens[i];
+        while (i > 0) {
+            int p = (i - 1) / D;
+            if (!menor(v, itens[p])) break;
+            itens[i] = itens[p];
+            posicao[itens[i]] = i;
+            i = p;
+        }
+        itens[i] = v;
+        posicao[v] = i;
+    }
+
+    void descer(int i) {
+        int v = itens[i];
+        int n = (int)itens.size();
+        while (true) {
+            int primeiro = D * i + 1;
+            if (primeiro >= n) break;
+            int m = primeiro;
+            for (int c = primeiro + 1; c < primeiro + D && c < n; ++c) {
+                if (menor(itens[c], itens[m])) m = c;
+            }
+            if (!menor(itens[m], v)) break;
+            itens[i] = itens[m];
+            posicao[itens[i]] = i;
+            i = m;
+        }
+        itens[i] = v;
+        posicao[v] = i;
+    }
+};
+
+// Prim sobre `arestas` com incidentes(u) dando os índices das arestas que tocam u.
+// A ordem total (peso, índice) faz a floresta ser a única mínima, a mesma do Kruskal
+template <typename W, typename Incidentes>
+static BasicSpanningForestResult<W> florestaDePrim(int numVertices, std::span<const BasicWeightedEdge<W>> arestas,
+                                                   Incidentes incidentes) {
+    // Ordem total estrita: (peso, posição)
+    auto precede = [&](int a, int b) {
+        return arestas[a].weight < arestas[b].weight || (!(arestas[b].weight < arestas[a].weight) && a < b);
+    };
+
+    // melhor[v]: aresta mais leve entre v e a árvore em crescimento (chave de v no heap)
+    std::vector<int> melhor(numVertices, -1);
+    std::vector<char> naArvore(numVertices, 0);
+    auto menor = [&](int a, int b) { return precede(melhor[a], melhor[b]); };
+    HeapIndexado<4, decltype(menor)> heap(numVertices, menor);
+
+    std::vector<BasicWeightedEdge<W>> escolhidas;
+    escolhidas.reserve(numVertices > 0 ? numVertices - 1 : 0);
+
+    auto relaxar = [&](int u) {
+        for (int e : incidentes(u)) {
+            int x = arestas[e].v == u ? arestas[e].w : arestas[e].v;
+            if (naArvore[x]) continue;
+            if (melhor[x] == -1 || precede(e, melhor[x])) {
+                melhor[x] = e;
+                if (heap.contem(x)) heap.diminuir(x);
+                else heap.inserir(x);
+            }
+        }
+    };
+
+    for (int s = 0; s < numVertices; ++s) {
+        if (naArvore[s]) continue;
+        naArvore[s] = 1;
+        relaxar(s);
+        while (!heap.vazio()) {
+            int u = heap.extrairMinimo();
+            naArvore[u] = 1;
+            escolhidas.push_back(arestas[melhor[u]]);
+            relaxar(u);
+        }
+    }
+
+    return KruskalMST::enraizarFloresta(numVertices, escolhidas);
+}
+
+template <typename W>
+BasicSpanningForestResult<W> PrimMST::construirFloresta(int numVertices, const std::vector<BasicWeightedEdge<W>>& arestas) {
+    // Adjacência plana das candidatas: cada aresta aparece nas duas pontas pelo seu índice
+    std::vector<int> offsets(numVertices + 1, 0);
+    for (const auto& a : arestas) {
+        offsets[a.v + 1]++;
+        offsets[a.w + 1]++;
+    }
+    for (int v = 0; v < numVertices; ++v) offsets[v + 1] += offsets[v];
+    std::vector<int> incidentes(offsets[numVertices]);
+    std::vector<int> pos(offsets.begin(), offsets.end() - 1);
+    for (int e = 0; e < (int)arestas.size(); ++e) {
+        incidentes[pos[arestas[e].v]++] = e;
+        incidentes[pos[arestas[e].w]++] = e;
+    }
+
+    return florestaDePrim<W>(numVertices, arestas, [&](int u) {
+        return std::span<const int>(incidentes.data() + offsets[u], incidentes.data() + offsets[u + 1]);
+    });
+}
+
+template <typename W>
+BasicSpanningForestResult<W> PrimMST::obterFlorestaGeradora(const BasicWeightedGraph<W>& grafoEntrada) {
+    std::vector<BasicWeightedEdge<W>> listaArestas;
+    listaArestas.reserve(grafoEntrada.E());
+    for (const auto& aresta : grafoEntrada.edges()) {
+        if (aresta.v < aresta.w) listaArestas.push_back(aresta);
+    }
+
+    BasicSpanningForestResult<W> resultado = construirFloresta(grafoEntrada.V(), listaArestas);
+    resultado.locateEdges(grafoEntrada);
+    return resultado;
+}
+
+template <typename W>
+BasicSpanningForestResult<W> PrimMST::obterFlorestaGeradora(const BasicCSRGraph<W>& grafoEntrada) {
+    std::vector<BasicWeightedEdge<W>> listaArestas;
+    listaArestas.reserve(grafoEntrada.E() / 2);
+    for (int u = 0; u < grafoEntrada.V(); ++u) {
+        for (int e = grafoEntrada.firstEdge(u); e < grafoEntrada.lastEdge(u); ++e) {
+            int v = grafoEntrada.target(e);
+            if (u < v) listaArestas.push_back(BasicWeightedEdge<W>(u, v, grafoEntrada.weight(e)));
+        }
+    }
+
+    BasicSpanningForestResult<W> resultado = construirFloresta(grafoEntrada.V(), listaArestas);
+    resultado.locateEdges(grafoEntrada);
+    return resultado;
+}
+
+// O array global de arestas e as listas de incidência já são a entrada do Prim: sem cópias
+template <typename W>
+BasicSpanningForestResult<W> PrimMST::obterFlorestaGeradora(const BasicUndirectedGraph<W>& grafoEntrada) {
+    BasicSpanningForestResult<W> resultado = florestaDePrim<W>(grafoEntrada.V(), grafoEntrada.edges(),
+        [&](int u) { return grafoEntrada.incidentEdges(u); });
+    resultado.locateEdges(grafoEntrada);
+    return resultado;
+}
+
+template <typename W>
+BasicWeightedGraph<W> PrimMST::obterArvoreGeradoraMinima(const BasicWeightedGraph<W>& grafoEntrada) {
+    return obterFlorestaGeradora(grafoEntrada).toWeightedGraph();
+}
+
+#define INSTANCIAR_PRIM(W) \
+    template BasicSpanningForestResult<W> PrimMST::obterFlorestaGeradora(const BasicWeightedGraph<W>&); \
+    template BasicSpanningForestResult<W> PrimMST::obterFlorestaGeradora(const BasicCSRGraph<W>&); \
+    template BasicSpanningForestResult<W> PrimMST::obterFlorestaGeradora(const BasicUndirectedGraph<W>&); \
+    template BasicWeightedGraph<W> PrimMST::obterArvoreGeradoraMinima(const BasicWeightedGraph<W>&); \
+    template BasicSpanningForestResult<W> PrimMST::construirFloresta(int, const std::vector<BasicWeightedEdge<W>>&);
+FOR_EACH_WEIGHT_TYPE(INSTANCIAR_PRIM)
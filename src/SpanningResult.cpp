@@ -0,0 +1,114 @@
+#include "SpanningResult.h"
+
+template <typename W>
+int BasicSpanningResult<W>::numEdges() const {
+    int m = 0;
+    for (int p : parent) {
+        if (p != -1) m++;
+    }
+    return m;
+}
+
+template <typename W>
+bool BasicSpanningResult<W>::reachesRoot() const {
+    int n = V();
+    if (root < 0 || root >= n) return false;
+    // 0 = não visto, 1 = no caminho atual, 2 = chega à raiz
+    std::vector<char> estado(n, 0);
+    estado[root] = 2;
+    std::vector<int> caminho;
+    for (int v = 0; v < n; ++v) {
+        caminho.clear();
+        int u = v;
+        while (estado[u] == 0) {
+            estado[u] = 1;
+            caminho.push_back(u);
+            u = parent[u];
+            if (u == -1) return false;
+        }
+        if (estado[u] == 1) return false;
+        for (int x : caminho) estado[x] = 2;
+    }
+    return true;
+}
+
+// Cada v tem no máximo uma aresta parent[v] -> v na entrada (grafos sem arestas repetidas)
+template <typename W>
+void BasicSpanningResult<W>::locateEdges(const BasicWeightedGraph<W>& grafo) {
+    totalCost = 0;
+    int id = 0;
+    for (const auto& e : grafo.edges()) {
+        if (parent[e.w] == e.v && edgeId[e.w] == -1) {
+            edgeId[e.w] = id;
+            totalCost += parentWeight[e.w];
+        }
+        id++;
+    }
+}
+
+template <typename W>
+void BasicSpanningResult<W>::locateEdges(const BasicCSRGraph<W>& grafo) {
+    totalCost = 0;
+    for (int u = 0; u < grafo.V(); ++u) {
+        for (int e = grafo.firstEdge(u); e < grafo.lastEdge(u); ++e) {
+            int v = grafo.target(e);
+            if (parent[v] == u && edgeId[v] == -1) {
+                edgeId[v] = e;
+                totalCost += parentWeight[v];
+            }
+        }
+    }
+}
+
+// Arestas guardadas uma vez: o filho pode ser qualquer uma das pontas
+template <typename W>
+void BasicSpanningResult<W>::locateEdges(const BasicUndirectedGraph<W>& grafo) {
+    totalCost = 0;
+    std::span<const BasicWeightedEdge<W>> arestas = grafo.edges();
+    for (int id = 0; id < (int)arestas.size(); ++id) {
+        const auto& e = arestas[id];
+        int filho = -1;
+        if (parent[e.w] == e.v && edgeId[e.w] == -1) filho = e.w;
+        else if (parent[e.v] == e.w && edgeId[e.v] == -1) filho = e.v;
+        if (filho != -1) {
+            edgeId[filho] = id;
+            totalCost += parentWeight[filho];
+        }
+    }
+}
+
+// Não-direcionado comprimido também guarda cada aresta uma vez (na lista da menor ponta)
+template <typename W>
+void BasicSpanningResult<W>::locateEdges(const BasicCompressedGraph<W>& grafo) {
+    totalCost = 0;
+    int id = 0;
+    for (const auto& e : grafo.edges()) {
+        int filho = -1;
+        if (parent[e.w] == e.v && edgeId[e.w] == -1) filho = e.w;
+        else if (!grafo.isDirected() && parent[e.v] == e.w && edgeId[e.v] == -1) filho = e.v;
+        if (filho != -1) {
+            edgeId[filho] = id;
+            totalCost += parentWeight[filho];
+        }
+        id++;
+    }
+}
+
+template <typename W>
+BasicWeightedGraph<W> BasicSpanningResult<W>::toWeightedGraph() const {
+    int n = V();
+    BasicWeightedGraph<W> grafo(n, directed);
+
+    std::vector<BasicWeightedEdge<W>> arestas;
+    arestas.reserve(numEdges());
+    for (int v = 0; v < n; ++v) {
+        if (parent[v] != -1) arestas.push_back(BasicWeightedEdge<W>(parent[v], v, parentWeight[v]));
+    }
+
+    // Grafo vazio: inserção em lote sem a checagem O(grau) de insertEdge
+    grafo.insertEdges(arestas);
+    return grafo;
+}
+
+#define INSTANCIAR_RESULTADO(W) template struct BasicSpanningResult<W>;
+FOR_EACH_WEIGHT_TYPE(INSTANCIAR_RESULTADO)
@@ -0,0 +1,135 @@
+#include "StrategyRunner.h"
+#include "KruskalMST.h"
+#include "BoruvkaMST.h"
+#include "PrimMST.h"
+#include "EdmondsMST.h"
+#include "TarjanMST.h"
+#include "GabowMST.h"
+#include "Parallel.h"
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <stdexcept>
+#include <string>
+
+const char* StrategyRunner::name(Strategy estrategia) {
+    switch (estrategia) {
+        case Strategy::KRUSKAL_MST: return "Kruskal (MST)";
+        case Strategy::BORUVKA_MST: return "Boruvka (MST)";
+        case Strategy::PRIM_MST: return "Prim (MST)";
+        case Strategy::AUTO_MST: return "Auto (MST)";
+        case Strategy::EDMONDS_MSA: return "Edmonds (MSA)";
+        case Strategy::TARJAN_MSA: return "Tarjan (MSA)";
+        case Strategy::GABOW_MSA: return "Gabow (MSA)";
+    }
+    return "?";
+}
+
+Strategy StrategyRunner::choose(long long numVertices, long long numArestas, int threads) {
+    if (threads > 1 && numArestas >= ARESTAS_PARALELO) return Strategy::BORUVKA_MST;
+    double completo = numVertices * (numVertices - 1) / 2.0;
+    if (completo > 0 && numArestas >= DENSIDADE_PRIM * completo) return Strategy::PRIM_MST;
+    return Strategy::KRUSKAL_MST;
+}
+
+Strategy StrategyRunner::choose(long long numVertices, long long numArestas) {
+    return choose(numVertices, numArestas, Parallel::numThreads());
+}
+
+template <typename W>
+Strategy StrategyRunner::resolve(const BasicWeightedGraph<W>& grafo, Strategy estrategia) {
+    if (estrategia != Strategy::AUTO_MST) return estrategia;
+    // Não-direcionado guarda as duas direções; direcionado: no máximo um par por arco
+    long long arestas = grafo.isDirected() ? grafo.E() : grafo.E() / 2;
+    return choose(grafo.V(), arestas);
+}
+
+template <typename W>
+Strategy StrategyRunner::resolve(const BasicUndirectedGraph<W>& grafo, Strategy estrategia) {
+    if (estrategia != Strategy::AUTO_MST) return estrategia;
+    return choose(grafo.V(), grafo.E());
+}
+
+template <typename W>
+BasicSpanningResult<W> StrategyRunner::run(const BasicWeightedGraph<W>& grafo, Strategy estrategia, int raiz) {
+    switch (estrategia) {
+        case Strategy::AUTO_MST: return run(grafo, resolve(grafo, estrategia), raiz);
+        case Strategy::KRUSKAL_MST:
+        case Strategy::BORUVKA_MST:
+        case Strategy::PRIM_MST: {
+            if (!grafo.isDirected()) {
+                if (estrategia == Strategy::BORUVKA_MST) return BoruvkaMST::obterFlorestaGeradora(grafo);
+                if (estrategia == Strategy::PRIM_MST) return PrimMST::obterFlorestaGeradora(grafo);
+                return KruskalMST::obterFlorestaGeradora(grafo);
+            }
+
+            std::vector<BasicWeightedEdge<W>> listaArestas;
+            listaArestas.reserve(grafo.E());
+            for (const auto& e : grafo.edges()) {
+                if (e.v != e.w) listaArestas.push_back(BasicWeightedEdge<W>(std::min(e.v, e.w), std::max(e.v, e.w), e.weight));
+            }
+            BasicSpanningResult<W> resultado =
+                estrategia == Strategy::BORUVKA_MST ? BoruvkaMST::construirFloresta(grafo.V(), listaArestas)
+                : estrategia == Strategy::PRIM_MST  ? PrimMST::construirFloresta(grafo.V(), listaArestas)
+                                                    : KruskalMST::construirFloresta(grafo.V(), listaArestas);
+            resultado.totalCost = 0;
+            for (int v = 0; v < resultado.V(); ++v) {
+                if (resultado.parent[v] != -1) resultado.totalCost += resultado.parentWeight[v];
+            }
+            return resultado;
+        }
+        case Strategy::EDMONDS_MSA: return EdmondsMST::obterPaisArborescencia(grafo, raiz);
+        case Strategy::TARJAN_MSA: return TarjanMST::obterPaisArborescencia(grafo, raiz);
+        case Strategy::GABOW_MSA: return GabowMST::obterPaisArborescencia(grafo, raiz);
+    }
+    return BasicSpanningResult<W>(grafo.V(), raiz);
+}
+
+template <typename W>
+BasicSpanningResult<W> StrategyRunner::run(const BasicUndirectedGraph<W>& grafo, Strategy estrategia) {
+    switch (resolve(grafo, estrategia)) {
+        case Strategy::BORUVKA_MST: return BoruvkaMST::obterFlorestaGeradora(grafo);
+        case Strategy::PRIM_MST: return PrimMST::obterFlorestaGeradora(grafo);
+        case Strategy::KRUSKAL_MST: return KruskalMST::obterFlorestaGeradora(grafo);
+        default: break;
+    }
+    throw std::invalid_argument(std::string("StrategyRunner: ") + name(estrategia) + " exige um grafo direcionado");
+}
+
+template <typename W>
+std::vector<BasicStrategyRun<W>> StrategyRunner::runConcurrently(const BasicWeightedGraph<W>& grafo,
+                                                                 std::span<const Strategy> estrategias,
+                                                                 int raiz) {
+    using Relogio = std::chrono::high_resolution_clock;
+    std::vector<BasicStrategyRun<W>> execucoes(estrategias.size());
+    std::vector<std::exception_ptr> erros(estrategias.size());
+
+    // Grão 1: cada estratégia é uma unidade de trabalho indivisível
+    Parallel::forRange(0, (long long)estrategias.size(), [&](long long a, long long b, int) {
+        for (long long i = a; i < b; ++i) {
+            execucoes[i].strategy = estrategias[i];
+            execucoes[i].motor = resolve(grafo, estrategias[i]);
+            try {
+                auto t0 = Relogio::now();
+                execucoes[i].resultado = run(grafo, execucoes[i].motor, raiz);
+                std::chrono::duration<double> dt = Relogio::now() - t0;
+                execucoes[i].segundos = dt.count();
+            } catch (...) {
+                erros[i] = std::current_exception();
+            }
+        }
+    }, 1);
+
+    for (const auto& erro : erros) {
+        if (erro) std::rethrow_exception(erro);
+    }
+    return execucoes;
+}
+
+#define INSTANCIAR_EXECUTOR(W) \
+    template Strategy StrategyRunner::resolve(const BasicWeightedGraph<W>&, Strategy); \
+    template Strategy StrategyRunner::resolve(const BasicUndirectedGraph<W>&, Strategy); \
+    template BasicSpanningResult<W> StrategyRunner::run(const BasicWeightedGraph<W>&, Strategy, int); \
+    template BasicSpanningResult<W> StrategyRunner::run(const BasicUndirectedGraph<W>&, Strategy); \
+    template std::vector<BasicStrategyRun<W>> StrategyRunner::runConcurrently(const BasicWeightedGraph<W>&, std::span<const Strategy>, int);
+FOR_EACH_WEIGHT_TYPE(INSTANCIAR_EXECUTOR)
@@ -3,38 +3,44 @@
 #include <vector>
 #include <algorithm>
 #include <memory>
+#include <memory_resource>
 #include <stack>
 
 using namespace std;
 
+// Chave do heap: custo reduzido (inteiros usam 64 bits com sinal, ver AccumWeight)
+template <typename K>
 struct SkewNode {
-    double peso;            
-    double propagacaoLazy;  
+    K peso;            
+    K propagacaoLazy;  
     int u, v;               
     int idOriginal;         
     SkewNode *esq, *dir;    
 
-    SkewNode(double w, int _u, int _v, int _id) 
+    SkewNode(K w, int _u, int _v, int _id) 
         : peso(w), propagacaoLazy(0), u(_u), v(_v), idOriginal(_id), esq(nullptr), dir(nullptr) {}
 };
 
+template <typename K>
 class TarjanSolver {
 private:
-    vector<SkewNode*> memoriaNodes; 
+    using SkewNode = ::SkewNode<K>;
+
+    // Um nó por aresta, todos vivos até o fim: arena monotônica dimensionada para m nós
+    // (os nós são trivialmente destrutíveis, a arena libera tudo de uma vez)
+    std::pmr::monotonic_buffer_resource memoriaNodes;
+    std::pmr::polymorphic_allocator<SkewNode> alocador;
     vector<SkewNode*> filasPrioridade; 
     vector<int> paiDSU; 
 
 public:
-    TarjanSolver(int n) {
+    TarjanSolver(int n, int m)
+        : memoriaNodes(std::max(1, m) * sizeof(SkewNode)), alocador(&memoriaNodes) {
         filasPrioridade.resize(2 * n, nullptr); 
         paiDSU.resize(2 * n);
         for(int i = 0; i < 2 * n; ++i) paiDSU[i] = i;
     }
 
-    ~TarjanSolver() {
-        for (auto node : memoriaNodes) delete node;
-    }
-
     void propagar(SkewNode* node) {
         if (!node || node->propagacaoLazy == 0) return;
         node->peso += node->propagacaoLazy;
@@ -54,9 +60,8 @@ public:
         return a;
     }
 
-    void push(int vertice, double w, int u, int v, int id) {
-        SkewNode* novo = new SkewNode(w, u, v, id);
-        memoriaNodes.push_back(novo);
+    void push(int vertice, K w, int u, int v, int id) {
+        SkewNode* novo = alocador.template new_object<SkewNode>(w, u, v, id);
         filasPrioridade[vertice] = merge(filasPrioridade[vertice], novo);
     }
 
@@ -72,7 +77,7 @@ public:
         return filasPrioridade[vertice];
     }
 
-    void addLazy(int vertice, double val) {
+    void addLazy(int vertice, K val) {
         if (filasPrioridade[vertice]) 
             filasPrioridade[vertice]->propagacaoLazy -= val;
     }
@@ -99,29 +104,20 @@ struct EstadoCiclo {
     vector<int> arestasEscolhidas; 
 };
 
-WeightedGraph TarjanMST::obterArborescencia(WeightedGraph& grafo, int raiz) {
-    int V = grafo.V();
-    vector<WeightedEdge> arestasReais;
-    int idCounter = 0;
-    
-    TarjanSolver solver(V);
+// Núcleo do algoritmo: recebe as arestas candidatas (SoA) já filtradas (sem laços e sem entrar na raiz)
+template <typename W>
+static BasicArborescenceResult<W> resolverTarjan(int V, int raiz, const BasicEdgeArrays<W>& arestasReais) {
+    using K = AccumWeight<W>;
+    TarjanSolver<K> solver(V, arestasReais.E());
 
-    for (int i = 0; i < V; ++i) {
-        WeightedGraph::AdjIterator it(grafo, i);
-        WeightedEdge e = it.begin();
-        while (e.v != -1) {
-            if (e.w != raiz && e.v != e.w) { 
-                arestasReais.push_back(e); 
-                solver.push(e.w, e.weight, e.v, e.w, idCounter);
-                idCounter++;
-            }
-            if (it.end()) break;
-            e = it.next();
-        }
+    for (int idCounter = 0; idCounter < arestasReais.E(); ++idCounter) {
+        int v = arestasReais.target(idCounter);
+        solver.push(v, arestasReais.weight(idCounter), arestasReais.source(idCounter), v, idCounter);
     }
 
     int numSuperVertices = V;
     vector<int> arestaEntrada(2 * V, -1); 
+    vector<K> custoEntrada(2 * V, K(0));  // Custo reduzido da aresta escolhida (chave no heap)
     vector<int> paiHierarquia(2 * V, -1); 
     stack<EstadoCiclo> historicoCiclos;   
     vector<int> caminhoVisitado(2 * V, -1);
@@ -132,7 +128,8 @@ WeightedGraph TarjanMST::obterArborescencia(WeightedGraph& grafo, int raiz) {
         int curr = solver.find(i);
         
         while (arestaEntrada[curr] == -1 && solver.find(raiz) != curr) {
-            SkewNode* minEdge = solver.top(curr);
+            caminhoVisitado[curr] = i;
+            SkewNode<K>* minEdge = solver.top(curr);
             
             // Remove arestas internas
             while (minEdge && solver.find(minEdge->u) == curr) {
@@ -143,6 +140,7 @@ WeightedGraph TarjanMST::obterArborescencia(WeightedGraph& grafo, int raiz) {
             if (!minEdge) break; 
 
             arestaEntrada[curr] = minEdge->idOriginal;
+            custoEntrada[curr] = minEdge->peso;
             int u_origem = solver.find(minEdge->u);
 
             if (u_origem == curr) {
@@ -157,7 +155,7 @@ WeightedGraph TarjanMST::obterArborescencia(WeightedGraph& grafo, int raiz) {
                 while (iter != curr) {
                     infoCiclo.nosNoCiclo.push_back(iter);
                     int edgeId = arestaEntrada[iter];
-                    iter = solver.find(arestasReais[edgeId].v); // Retrocede
+                    iter = solver.find(arestasReais.source(edgeId)); // Retrocede
                 }
                 infoCiclo.nosNoCiclo.push_back(curr);
                 
@@ -166,8 +164,9 @@ WeightedGraph TarjanMST::obterArborescencia(WeightedGraph& grafo, int raiz) {
                     
                     paiHierarquia[nodeDoCiclo] = novoSuperNo;
 
-                    double pesoArestaCiclo = arestasReais[arestaEntrada[nodeDoCiclo]].weight;
-                    solver.addLazy(nodeDoCiclo, pesoArestaCiclo);
+                    // Desconta o custo reduzido (já descontado de contrações anteriores),
+                    // não o peso original da aresta
+                    solver.addLazy(nodeDoCiclo, custoEntrada[nodeDoCiclo]);
                     solver.unirHeaps(novoSuperNo, nodeDoCiclo);
                     
                     solver.unite(nodeDoCiclo, novoSuperNo);
@@ -175,10 +174,8 @@ WeightedGraph TarjanMST::obterArborescencia(WeightedGraph& grafo, int raiz) {
 
                 historicoCiclos.push(infoCiclo);
                 curr = novoSuperNo; 
-                caminhoVisitado[curr] = i; 
 
             } else {
-                caminhoVisitado[u_origem] = i; 
                 curr = u_origem;
             }
         }
@@ -193,7 +190,7 @@ WeightedGraph TarjanMST::obterArborescencia(WeightedGraph& grafo, int raiz) {
 
         int noEntradaReal = -1;
         if (arestaQueEntraNoSuperNo != -1) {
-            int destino = arestasReais[arestaQueEntraNoSuperNo].w; 
+            int destino = arestasReais.target(arestaQueEntraNoSuperNo); 
             
             int ancestral = destino;
             bool achou = false;
@@ -222,15 +219,95 @@ WeightedGraph TarjanMST::obterArborescencia(WeightedGraph& grafo, int raiz) {
         }
     }
 
-    WeightedGraph resultado(V, true);
+    BasicArborescenceResult<W> resultado(V, raiz, true);
     for (int i = 0; i < V; ++i) {
         if (i == raiz) continue;
         int id = arestaEntrada[i];
         if (id != -1) {
-            const auto& a = arestasReais[id];
-            resultado.insertEdge(a.v, a.w, a.weight);
+            resultado.parent[arestasReais.target(id)] = arestasReais.source(id);
+            resultado.parentWeight[arestasReais.target(id)] = arestasReais.weight(id);
+        }
+    }
+
+    // Vértice sem aresta de entrada, ou ciclo sem entrada vinda da raiz: a arborescência
+    // não existe, com o mesmo sentido de success do Edmonds
+    resultado.success = resultado.reachesRoot();
+    return resultado;
+}
+
+template <typename W>
+BasicArborescenceResult<W> TarjanMST::obterPaisArborescencia(const BasicWeightedGraph<W>& grafo, int raiz) {
+    int V = grafo.V();
+    BasicEdgeArrays<W> arestasReais(V);
+    arestasReais.reserve(grafo.E());
+
+    // Arestas agrupadas por destino (lista de entrada): cada heap recebe as suas em sequência
+    for (int v = 0; v < V; ++v) {
+        if (v == raiz) continue;
+        for (const auto& e : grafo.inEdges(v)) {
+            if (e.v != v) {
+                arestasReais.push_back(e.v, v, e.weight);
+            }
+        }
+    }
+
+    BasicArborescenceResult<W> resultado = resolverTarjan(V, raiz, arestasReais);
+    resultado.locateEdges(grafo);
+    return resultado;
+}
+
+template <typename W>
+BasicArborescenceResult<W> TarjanMST::obterPaisArborescencia(const BasicCSRGraph<W>& grafo, int raiz) {
+    int V = grafo.V();
+    BasicEdgeArrays<W> arestasReais(V);
+    arestasReais.reserve(grafo.E());
+
+    for (int u = 0; u < V; ++u) {
+        for (int e = grafo.firstEdge(u); e < grafo.lastEdge(u); ++e) {
+            int v = grafo.target(e);
+            if (v != raiz && u != v) {
+                arestasReais.push_back(u, v, grafo.weight(e));
+            }
+        }
+    }
+
+    BasicArborescenceResult<W> resultado = resolverTarjan(V, raiz, arestasReais);
+    resultado.locateEdges(grafo);
+    return resultado;
+}
+
+// Listas comprimidas decodificadas uma vez, direto para as arestas candidatas
+template <typename W>
+BasicArborescenceResult<W> TarjanMST::obterPaisArborescencia(const BasicCompressedGraph<W>& grafo, int raiz) {
+    int V = grafo.V();
+    BasicEdgeArrays<W> arestasReais(V);
+    arestasReais.reserve(grafo.E());
+
+    for (const auto& e : grafo.edges()) {
+        if (e.w != raiz && e.v != e.w) {
+            arestasReais.push_back(e.v, e.w, e.weight);
         }
     }
 
+    BasicArborescenceResult<W> resultado = resolverTarjan(V, raiz, arestasReais);
+    resultado.locateEdges(grafo);
     return resultado;
-}
\ No newline at end of file
+}
+
+template <typename W>
+BasicWeightedGraph<W> TarjanMST::obterArborescencia(const BasicWeightedGraph<W>& grafo, int raiz) {
+    return obterPaisArborescencia(grafo, raiz).toWeightedGraph();
+}
+
+template <typename W>
+BasicWeightedGraph<W> TarjanMST::obterArborescencia(const BasicCSRGraph<W>& grafo, int raiz) {
+    return obterPaisArborescencia(grafo, raiz).toWeightedGraph();
+}
+
+#define INSTANCIAR_TARJAN(W) \
+    template BasicWeightedGraph<W> TarjanMST::obterArborescencia(const BasicWeightedGraph<W>&, int); \
+    template BasicWeightedGraph<W> TarjanMST::obterArborescencia(const BasicCSRGraph<W>&, int); \
+    template BasicArborescenceResult<W> TarjanMST::obterPaisArborescencia(const BasicWeightedGraph<W>&, int); \
+    template BasicArborescenceResult<W> TarjanMST::obterPaisArborescencia(const BasicCSRGraph<W>&, int); \
+    template BasicArborescenceResult<W> TarjanMST::obterPaisArborescencia(const BasicCompressedGraph<W>&, int);
+FOR_EACH_WEIGHT_TYPE(INSTANCIAR_TARJAN)
@@ -0,0 +1,170 @@
+#include "UndirectedGraph.h"
+#include "Parallel.h"
+#include "EdgeSort.h"
+#include <algorithm>
+#include <utility>
+
+template <typename W>
+BasicUndirectedGraph<W>::BasicUndirectedGraph(int V, std::pmr::memory_resource* recurso)
+    : GraphBase(V, false), arestas(recurso), incidencia(V, recurso) {}
+
+template <typename W>
+BasicUndirectedGraph<W>::BasicUndirectedGraph(const BasicWeightedGraph<W>& grafo)
+    : BasicUndirectedGraph(grafo.V()) {
+    std::vector<Edge> lote;
+    lote.reserve(grafo.E() / 2 + 1);
+    for (const auto& e : grafo.edges()) {
+        if (e.v <= e.w) lote.push_back(e);
+    }
+    insertEdges(lote);
+}
+
+// Percorre a incidência da ponta de menor grau
+template <typename W>
+int BasicUndirectedGraph<W>::findEdge(int v, int w) const {
+    if (incidencia[w].size() < incidencia[v].size()) std::swap(v, w);
+    for (int id : incidencia[v]) {
+        if (opposite(id, v) == w) return id;
+    }
+    return -1;
+}
+
+template <typename W>
+void BasicUndirectedGraph<W>::appendEdge(int v, int w, W peso) {
+    if (v > w) std::swap(v, w);
+    int id = (int)arestas.size();
+    arestas.push_back(Edge(v, w, peso));
+    incidencia[v].push_back(id);
+    if (v != w) incidencia[w].push_back(id);
+    numE++;
+}
+
+template <typename W>
+void BasicUndirectedGraph<W>::insertEdge(int v, int w, W peso) {
+    if (findEdge(v, w) == -1) appendEdge(v, w, peso);
+}
+
+template <typename W>
+void BasicUndirectedGraph<W>::insertEdges(std::span<const Edge> novas, DuplicatePolicy politica) {
+    std::vector<Edge> lote(novas.begin(), novas.end());
+    for (auto& a : lote) {
+        if (a.v > a.w) std::swap(a.v, a.w);
+    }
+
+    // Ordenação estável por (v, w): a primeira ocorrência de cada par fica à frente
+    Parallel::stableSort(lote.begin(), lote.end(), [](const Edge& a, const Edge& b) {
+        return a.v != b.v ? a.v < b.v : a.w < b.w;
+    });
+
+    size_t unicos = 0;
+    for (size_t i = 0; i < lote.size(); ++i) {
+        if (unicos > 0 && lote[unicos - 1].v == lote[i].v && lote[unicos - 1].w == lote[i].w) {
+            lote[unicos - 1].weight = combinarPeso(lote[unicos - 1].weight, lote[i].weight, politica);
+        } else {
+            lote[unicos++] = lote[i];
+        }
+    }
+    lote.resize(unicos);
+
+    if (numE == 0) {
+        // Grafo vazio: reserva exata do array e de cada lista de incidência
+        std::vector<int> grau(numV, 0);
+        for (const auto& a : lote) {
+            grau[a.v]++;
+            if (a.v != a.w) grau[a.w]++;
+        }
+        for (int v = 0; v < numV; ++v) incidencia[v].reserve(grau[v]);
+        arestas.reserve(lote.size());
+
+        for (const auto& a : lote) appendEdge(a.v, a.w, a.weight);
+        return;
+    }
+
+    for (const auto& a : lote) {
+        int id = findEdge(a.v, a.w);
+        if (id == -1) {
+            appendEdge(a.v, a.w, a.weight);
+        } else {
+            arestas[id].weight = combinarPeso(arestas[id].weight, a.weight, politica);
+        }
+    }
+}
+
+template <typename W>
+void BasicUndirectedGraph<W>::removeEdge(int v, int w) {
+    int id = findEdge(v, w);
+    if (id == -1) return;
+
+    auto retirar = [&](int x, int alvo) {
+        auto& lista = incidencia[x];
+        lista.erase(std::find(lista.begin(), lista.end(), alvo));
+    };
+    retirar(arestas[id].v, id);
+    if (arestas[id].v != arestas[id].w) retirar(arestas[id].w, id);
+
+    // A última aresta ocupa a posição liberada
+    int ultima = (int)arestas.size() - 1;
+    if (id != ultima) {
+        arestas[id] = arestas[ultima];
+        for (int x : {arestas[id].v, arestas[id].w}) {
+            std::replace(incidencia[x].begin(), incidencia[x].end(), ultima, id);
+        }
+    }
+    arestas.pop_back();
+    numE--;
+}
+
+template <typename W>
+bool BasicUndirectedGraph<W>::updateWeight(int v, int w, W novoPeso) {
+    int id = findEdge(v, w);
+    if (id == -1) return false;
+    arestas[id].weight = novoPeso;
+    return true;
+}
+
+template <typename W>
+bool BasicUndirectedGraph<W>::hasEdge(int v, int w) const {
+    return findEdge(v, w) != -1;
+}
+
+template <typename W>
+std::optional<W> BasicUndirectedGraph<W>::getWeight(int v, int w) const {
+    int id = findEdge(v, w);
+    if (id == -1) return std::nullopt;
+    return arestas[id].weight;
+}
+
+template <typename W>
+size_t BasicUndirectedGraph<W>::memoryUsage() const {
+    size_t bytes = sizeof(*this) + arestas.capacity() * sizeof(Edge) + incidencia.capacity() * sizeof(incidencia[0]);
+    for (const auto& lista : incidencia) bytes += lista.capacity() * sizeof(int);
+    return bytes;
+}
+
+template <typename W>
+GraphStats BasicUndirectedGraph<W>::stats() const {
+    GraphStats s = GraphStats::compute(numV, numE, false, true, [this](int v, auto&& visitar) {
+        for (int id : incidencia[v]) visitar(opposite(id, v), (double)arestas[id].weight);
+    });
+    s.memoryBytes = memoryUsage();
+    return s;
+}
+
+// As listas mantêm a capacidade; cada uma fica em ordem crescente de índice
+template <typename W>
+void BasicUndirectedGraph<W>::rebuildIncidence() {
+    for (auto& lista : incidencia) lista.clear();
+    for (int id = 0; id < (int)arestas.size(); ++id) {
+        incidencia[arestas[id].v].push_back(id);
+        if (arestas[id].v != arestas[id].w) incidencia[arestas[id].w].push_back(id);
+    }
+}
+
+template <typename W>
+void BasicUndirectedGraph<W>::sortEdgesByWeight() {
+    EdgeSort::byWeight<W>(arestas);
+    rebuildIncidence();
+}
+
+#define INSTANCIAR_NAO_DIRECIONADO(W) template class BasicUndirectedGraph<W>;
+FOR_EACH_WEIGHT_TYPE(INSTANCIAR_NAO_DIRECIONADO)
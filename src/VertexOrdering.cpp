@@ -0,0 +1,256 @@
+#include "VertexOrdering.h"
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+
+namespace {
+
+VertexPermutation deOrdem(std::vector<int> ordem) {
+    VertexPermutation p;
+    p.novoDe.assign(ordem.size(), -1);
+    for (int i = 0; i < (int)ordem.size(); ++i) p.novoDe[ordem[i]] = i;
+    p.antigoDe = std::move(ordem);
+    return p;
+}
+
+// Vizinhos nos dois sentidos (saída e, se direcionado, entrada)
+template <typename W, typename F>
+void paraCadaVizinho(const BasicWeightedGraph<W>& grafo, int u, F&& visitar) {
+    for (const auto& e : grafo.neighbors(u)) visitar(e.w);
+    if (grafo.isDirected()) {
+        for (const auto& e : grafo.inEdges(u)) visitar(e.v);
+    }
+}
+
+template <typename W>
+std::vector<int> grausTotais(const BasicWeightedGraph<W>& grafo) {
+    std::vector<int> grau(grafo.V());
+    for (int v = 0; v < grafo.V(); ++v) {
+        grau[v] = grafo.degree(v) + (grafo.isDirected() ? (int)grafo.inEdges(v).size() : 0);
+    }
+    return grau;
+}
+
+// Vizinhos nos dois sentidos em CSR, só rótulos: por vértice, as saídas em ordem de
+// destino e depois (se direcionado) as entradas em ordem de origem, sem repetições.
+// É a sequência que paraCadaVizinho visitaria no grafo montado com as mesmas arestas.
+struct Vizinhanca {
+    std::vector<int> offsets, vizinhos;
+};
+
+template <typename W>
+Vizinhanca vizinhancaDeArestas(int n, std::span<const BasicWeightedEdge<W>> arestas, bool directed) {
+    // Um balde por (vértice, sentido), preenchido por contagem
+    int sentidos = directed ? 2 : 1;
+    auto paraCadaEntrada = [&](auto&& emitir) {
+        for (const auto& a : arestas) {
+            emitir((size_t)a.v * sentidos, a.w);
+            if (directed) emitir((size_t)a.w * 2 + 1, a.v);
+            else if (a.v != a.w) emitir((size_t)a.w, a.v);
+        }
+    };
+    std::vector<int> inicio((size_t)n * sentidos + 1, 0);
+    paraCadaEntrada([&](size_t balde, int) { inicio[balde + 1]++; });
+    for (size_t b = 0; b + 1 < inicio.size(); ++b) inicio[b + 1] += inicio[b];
+    std::vector<int> bruto(inicio.back());
+    std::vector<int> pos(inicio.begin(), inicio.end() - 1);
+    paraCadaEntrada([&](size_t balde, int x) { bruto[pos[balde]++] = x; });
+
+    Vizinhanca viz;
+    viz.offsets.assign(n + 1, 0);
+    viz.vizinhos.reserve(bruto.size());
+    for (size_t b = 0; b + 1 < inicio.size(); ++b) {
+        auto ini = bruto.begin() + inicio[b], fim = bruto.begin() + inicio[b + 1];
+        std::sort(ini, fim);
+        viz.vizinhos.insert(viz.vizinhos.end(), ini, std::unique(ini, fim));
+        viz.offsets[b / sentidos + 1] = (int)viz.vizinhos.size();
+    }
+    return viz;
+}
+
+// BFS por componente, na ordem dada de candidatos a origem; com `grau`, cada leva
+// de vizinhos recém-descobertos entra em ordem crescente de grau (Cuthill-McKee)
+template <typename Vizinhos>
+std::vector<int> ordemBFS(int n, Vizinhos&& vizinhos, const std::vector<int>& origens,
+                          const std::vector<int>* grau) {
+    std::vector<char> visitado(n, 0);
+    std::vector<int> ordem;
+    ordem.reserve(n);
+    for (int s : origens) {
+        if (visitado[s]) continue;
+        visitado[s] = 1;
+        size_t ini = ordem.size();
+        ordem.push_back(s);
+        while (ini < ordem.size()) {
+            int u = ordem[ini++];
+            size_t leva = ordem.size();
+            vizinhos(u, [&](int v) {
+                if (visitado[v]) return;
+                visitado[v] = 1;
+                ordem.push_back(v);
+            });
+            if (grau) {
+                std::stable_sort(ordem.begin() + leva, ordem.end(), [&](int a, int b) {
+                    return (*grau)[a] < (*grau)[b];
+                });
+            }
+        }
+    }
+    return ordem;
+}
+
+// Índice na curva de Hilbert de ordem 16 (grade 65536 x 65536)
+uint64_t indiceHilbert(uint32_t x, uint32_t y) {
+    const uint32_t n = 1u << 16;
+    uint64_t d = 0;
+    for (uint32_t s = n / 2; s > 0; s /= 2) {
+        uint32_t rx = (x & s) > 0;
+        uint32_t ry = (y & s) > 0;
+        d += (uint64_t)s * s * ((3 * rx) ^ ry);
+        if (ry == 0) {
+            if (rx == 1) {
+                x = n - 1 - x;
+                y = n - 1 - y;
+            }
+            std::swap(x, y);
+        }
+    }
+    return d;
+}
+
+}
+
+VertexPermutation VertexOrdering::hilbert(std::span<const std::pair<double, double>> coordenadas) {
+    int n = (int)coordenadas.size();
+    if (n == 0) return VertexPermutation{};
+
+    double minX = coordenadas[0].first, maxX = minX, minY = coordenadas[0].second, maxY = minY;
+    for (const auto& [x, y] : coordenadas) {
+        minX = std::min(minX, x); maxX = std::max(maxX, x);
+        minY = std::min(minY, y); maxY = std::max(maxY, y);
+    }
+    // Mesma escala nos dois eixos: a caixa envolvente vira o quadrado da curva
+    double lado = std::max(maxX - minX, maxY - minY);
+    double escala = lado > 0 ? 65535.0 / lado : 0.0;
+
+    std::vector<uint64_t> chave(n);
+    for (int v = 0; v < n; ++v) {
+        chave[v] = indiceHilbert((uint32_t)((coordenadas[v].first - minX) * escala),
+                                 (uint32_t)((coordenadas[v].second - minY) * escala));
+    }
+
+    std::vector<int> ordem(n);
+    std::iota(ordem.begin(), ordem.end(), 0);
+    std::stable_sort(ordem.begin(), ordem.end(), [&](int a, int b) { return chave[a] < chave[b]; });
+    return deOrdem(std::move(ordem));
+}
+
+namespace {
+
+// Núcleo comum: `vizinhos(u, visitar)` percorre os vizinhos nos dois sentidos e
+// `graus()` devolve o grau total de cada vértice
+template <typename Vizinhos, typename Graus>
+VertexPermutation calcular(int n, Ordering ordem, std::span<const std::pair<double, double>> coordenadas,
+                           Vizinhos&& vizinhos, Graus&& graus) {
+    std::vector<int> identidade(n);
+    std::iota(identidade.begin(), identidade.end(), 0);
+
+    switch (ordem) {
+        case Ordering::ORIGINAL:
+            return deOrdem(std::move(identidade));
+
+        case Ordering::BFS:
+            return deOrdem(ordemBFS(n, vizinhos, identidade, nullptr));
+
+        case Ordering::RCM: {
+            // Origens por grau crescente: cada componente parte de um vértice periférico
+            std::vector<int> grau = graus();
+            std::stable_sort(identidade.begin(), identidade.end(), [&](int a, int b) { return grau[a] < grau[b]; });
+            std::vector<int> cm = ordemBFS(n, vizinhos, identidade, &grau);
+            std::reverse(cm.begin(), cm.end());
+            return deOrdem(std::move(cm));
+        }
+
+        case Ordering::DEGREE: {
+            std::vector<int> grau = graus();
+            std::stable_sort(identidade.begin(), identidade.end(), [&](int a, int b) { return grau[a] > grau[b]; });
+            return deOrdem(std::move(identidade));
+        }
+
+        case Ordering::HILBERT:
+            if ((int)coordenadas.size() != n)
+                throw std::invalid_argument("VertexOrdering: HILBERT exige uma coordenada por vértice");
+            return VertexOrdering::hilbert(coordenadas);
+    }
+    return deOrdem(std::move(identidade));
+}
+
+}
+
+template <typename W>
+VertexPermutation VertexOrdering::compute(const BasicWeightedGraph<W>& grafo, Ordering ordem,
+                                          std::span<const std::pair<double, double>> coordenadas) {
+    return calcular(
+        grafo.V(), ordem, coordenadas,
+        [&](int u, auto&& visitar) { paraCadaVizinho(grafo, u, visitar); },
+        [&] { return grausTotais(grafo); });
+}
+
+template <typename W>
+VertexPermutation VertexOrdering::compute(int numVertices, std::span<const BasicWeightedEdge<W>> arestas,
+                                          bool directed, Ordering ordem,
+                                          std::span<const std::pair<double, double>> coordenadas) {
+    // ORIGINAL e HILBERT não olham as arestas
+    Vizinhanca viz;
+    if (ordem == Ordering::BFS || ordem == Ordering::RCM || ordem == Ordering::DEGREE)
+        viz = vizinhancaDeArestas(numVertices, arestas, directed);
+    return calcular(
+        numVertices, ordem, coordenadas,
+        [&](int u, auto&& visitar) {
+            for (int i = viz.offsets[u]; i < viz.offsets[u + 1]; ++i) visitar(viz.vizinhos[i]);
+        },
+        [&] {
+            std::vector<int> grau(numVertices);
+            for (int v = 0; v < numVertices; ++v) grau[v] = viz.offsets[v + 1] - viz.offsets[v];
+            return grau;
+        });
+}
+
+template <typename W>
+BasicWeightedGraph<W> VertexOrdering::apply(const BasicWeightedGraph<W>& grafo, const VertexPermutation& p) {
+    std::vector<BasicWeightedEdge<W>> lote;
+    lote.reserve(grafo.E());
+    for (const auto& e : grafo.edges()) {
+        int a = p.toNew(e.v), b = p.toNew(e.w);
+        // Não-direcionado: uma das duas cópias basta, insertEdges cria a outra
+        if (!grafo.isDirected() && a > b) continue;
+        lote.push_back(BasicWeightedEdge<W>(a, b, e.weight));
+    }
+
+    // insertEdges mantém a ordem da entrada: em ordem de (a, b), cada lista sai por destino
+    std::sort(lote.begin(), lote.end(), [](const auto& x, const auto& y) {
+        return x.v != y.v ? x.v < y.v : x.w < y.w;
+    });
+    BasicWeightedGraph<W> permutado(grafo.V(), grafo.isDirected());
+    permutado.insertEdges(lote);
+    return permutado;
+}
+
+template <typename W>
+BasicReorderedGraph<W> VertexOrdering::reorderVertices(const BasicWeightedGraph<W>& grafo, Ordering ordem,
+                                                       std::span<const std::pair<double, double>> coordenadas) {
+    VertexPermutation p = compute(grafo, ordem, coordenadas);
+    BasicWeightedGraph<W> permutado = apply(grafo, p);
+    return BasicReorderedGraph<W>{std::move(permutado), std::move(p)};
+}
+
+#define INSTANCIAR_ORDENACAO(W) \
+    template VertexPermutation VertexOrdering::compute(const BasicWeightedGraph<W>&, Ordering, \
+                                                       std::span<const std::pair<double, double>>); \
+    template VertexPermutation VertexOrdering::compute(int, std::span<const BasicWeightedEdge<W>>, bool, Ordering, \
+                                                       std::span<const std::pair<double, double>>); \
+    template BasicWeightedGraph<W> VertexOrdering::apply(const BasicWeightedGraph<W>&, const VertexPermutation&); \
+    template BasicReorderedGraph<W> VertexOrdering::reorderVertices(const BasicWeightedGraph<W>&, Ordering, \
+                                                                    std::span<const std::pair<double, double>>);
+FOR_EACH_WEIGHT_TYPE(INSTANCIAR_ORDENACAO)
@@ -1,92 +1,372 @@
 #include "WeightedGraph.h"
+#include "CSRGraph.h"
+#include "Parallel.h"
+#include <algorithm>
+#include <atomic>
 #include <iostream>
+#include <stdexcept>
 
-WeightedGraph::WeightedGraph(int V, bool directed)
-    : GraphBase(V, directed), adj(V), directed(directed) {}  
+template <typename W>
+BasicWeightedGraph<W>::BasicWeightedGraph(int V, bool directed, std::pmr::memory_resource* recurso)
+    : GraphBase(V, directed), recurso(recurso), diretorio(novoDiretorio(V, recurso)), directed(directed),
+      usarIndice(false), inOffsets(recurso), inAdj(recurso) {}  
 
-WeightedGraph::~WeightedGraph() {
+template <typename W>
+BasicWeightedGraph<W>::~BasicWeightedGraph() {
 }
 
-void WeightedGraph::insertEdge(int v, int w, double peso) {
+template <typename W>
+BasicWeightedGraph<W>::BasicWeightedGraph(const BasicWeightedGraph& outro)
+    : BasicWeightedGraph(outro.numV, outro.directed) {
+    for (int v = 0; v < numV; ++v) {
+        const Lista& origem = outro.lista(v);
+        listaMutavel(v).assign(origem.begin(), origem.end());
+    }
+    numE = outro.numE;
+    indice = outro.indice;
+    usarIndice = outro.usarIndice;
+}
+
+template <typename W>
+BasicWeightedGraph<W>& BasicWeightedGraph<W>::operator=(const BasicWeightedGraph& outro) {
+    if (this != &outro) *this = BasicWeightedGraph(outro);
+    return *this;
+}
+
+template <typename W>
+std::shared_ptr<typename BasicWeightedGraph<W>::Diretorio>
+BasicWeightedGraph<W>::novoDiretorio(int V, std::pmr::memory_resource* recurso) {
+    std::pmr::polymorphic_allocator<Diretorio> alocador(recurso);
+    auto dir = std::allocate_shared<Diretorio>(alocador, recurso);
+    int numBlocos = (V + TAM_BLOCO - 1) / TAM_BLOCO;
+    dir->blocos.reserve(numBlocos);
+    for (int b = 0; b < numBlocos; ++b) {
+        int tamanho = std::min(TAM_BLOCO, V - b * TAM_BLOCO);
+        dir->blocos.push_back(std::allocate_shared<Bloco>(std::pmr::polymorphic_allocator<Bloco>(recurso), tamanho, recurso));
+    }
+    return dir;
+}
+
+// Cópia na escrita: se outra versão ainda referencia o diretório ou o bloco de v,
+// esta versão passa a ter a sua própria cópia antes de alterá-lo
+template <typename W>
+typename BasicWeightedGraph<W>::Lista& BasicWeightedGraph<W>::listaMutavel(int v) {
+    if (diretorio.use_count() > 1) {
+        diretorio = std::allocate_shared<Diretorio>(std::pmr::polymorphic_allocator<Diretorio>(recurso), *diretorio, recurso);
+    }
+    std::shared_ptr<Bloco>& bloco = diretorio->blocos[v >> BITS_BLOCO];
+    if (bloco.use_count() > 1) {
+        bloco = std::allocate_shared<Bloco>(std::pmr::polymorphic_allocator<Bloco>(recurso), *bloco, recurso);
+    }
+    // Uma versão que acabou de soltar o bloco em outra thread terminou de lê-lo antes disso
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return bloco->listas[v & (TAM_BLOCO - 1)];
+}
+
+template <typename W>
+BasicWeightedGraph<W> BasicWeightedGraph<W>::snapshot() const {
+    BasicWeightedGraph<W> versao(0, directed, recurso);
+    versao.numV = numV;
+    versao.numE = numE;
+    versao.diretorio = diretorio;
+    return versao;
+}
+
+template <typename W>
+int BasicWeightedGraph<W>::sharedBlocks(const BasicWeightedGraph& outra) const {
+    if (diretorio == outra.diretorio) return (int)diretorio->blocos.size();
+    int comuns = 0;
+    size_t n = std::min(diretorio->blocos.size(), outra.diretorio->blocos.size());
+    for (size_t b = 0; b < n; ++b) {
+        if (diretorio->blocos[b] == outra.diretorio->blocos[b]) comuns++;
+    }
+    return comuns;
+}
+
+template <typename W>
+int BasicWeightedGraph<W>::findEdge(int v, int w) const {
+    if (usarIndice) return indice.find(v, w);
+    const Lista& l = lista(v);
+    for (int i = 0; i < (int)l.size(); ++i) {
+        if (l[i].w == w) return i;
+    }
+    return -1;
+}
+
+template <typename W>
+void BasicWeightedGraph<W>::enableEdgeIndex() {
+    indice.clear();
+    indice.reserve(numE);
+    for (int v = 0; v < numV; ++v) {
+        const Lista& l = lista(v);
+        for (int i = 0; i < (int)l.size(); ++i) {
+            indice.insert(v, l[i].w, i);
+        }
+    }
+    usarIndice = true;
+}
+
+template <typename W>
+void BasicWeightedGraph<W>::disableEdgeIndex() {
+    indice.clear();
+    usarIndice = false;
+}
+
+// Adiciona ao fim da lista de v, mantendo o índice sincronizado
+template <typename W>
+void BasicWeightedGraph<W>::appendEdge(int v, int w, W peso) {
+    Lista& l = listaMutavel(v);
+    l.push_back(Edge(v, w, peso));
+    if (usarIndice) indice.insert(v, w, (int)l.size() - 1);
+    numE++;
+    invalidarEntrada();
+}
+
+// Remove a aresta na posição pos da lista de v; as seguintes recuam uma posição no índice
+template <typename W>
+void BasicWeightedGraph<W>::eraseEdgeAt(int v, int pos) {
+    Lista& l = listaMutavel(v);
+    if (usarIndice) {
+        indice.erase(v, l[pos].w);
+        for (int i = pos + 1; i < (int)l.size(); ++i) {
+            indice.insert(v, l[i].w, i - 1);
+        }
+    }
+    l.erase(l.begin() + pos);
+    numE--;
+    invalidarEntrada();
+}
+
+template <typename W>
+void BasicWeightedGraph<W>::insertEdge(int v, int w, W peso) {
     if (!hasEdge(v, w)) {
-        adj[v].push_back(WeightedEdge(v, w, peso));
-        numE++;
+        appendEdge(v, w, peso);
     }
     if (!directed && !hasEdge(w, v)) {
-        adj[w].push_back(WeightedEdge(w, v, peso));
-        numE++;
+        appendEdge(w, v, peso);
     }
 }
 
-void WeightedGraph::removeEdge(int v, int w) {
-    for (auto it = adj[v].begin(); it != adj[v].end(); ++it) {
-        if (it->w == w) {
-            adj[v].erase(it);
-            numE--;
-            break;
+template <typename W>
+void BasicWeightedGraph<W>::insertEdges(std::span<const Edge> arestas, DuplicatePolicy politica) {
+    if (numE == 0) {
+        // Grafo vazio: nada a conferir, montagem paralela em CSR e cópia com reserva exata
+        // Blocos novos, exclusivos desta versão: as threads escrevem sem cópia na escrita
+        BasicCSRGraph<W> csr = BasicCSRGraph<W>::fromEdges(numV, arestas, directed, politica);
+        diretorio = novoDiretorio(numV, recurso);
+        auto copiar = [&](long long a, long long b, int) {
+            for (long long v = a; v < b; ++v) {
+                Lista& l = diretorio->blocos[v >> BITS_BLOCO]->listas[v & (TAM_BLOCO - 1)];
+                l.reserve(csr.degree(v));
+                for (int e = csr.firstEdge(v); e < csr.lastEdge(v); ++e) {
+                    l.push_back(Edge(v, csr.target(e), csr.weight(e)));
+                }
+            }
+        };
+        // Arenas (p.ex. monotonic_buffer_resource) não são thread-safe: só o heap é dividido
+        if (recurso->is_equal(*std::pmr::new_delete_resource())) {
+            Parallel::forRange(0, numV, copiar, 1 << 12);
+        } else {
+            copiar(0, numV, 0);
         }
+        numE = csr.E();
+        if (usarIndice) enableEdgeIndex();
+        invalidarEntrada();
+        return;
     }
-    if (!directed) {
-        for (auto it = adj[w].begin(); it != adj[w].end(); ++it) {
-            if (it->w == v) {
-                adj[w].erase(it);
-                numE--;
-                break;
+
+    // Em grafos não-direcionados (v, w) e (w, v) são a mesma aresta. Cada item guarda a
+    // posição da aresta na entrada, para que as novas entrem na ordem em que foram dadas
+    struct Item {
+        Edge aresta;
+        size_t indice;
+    };
+    std::vector<Item> lote;
+    lote.reserve(arestas.size());
+    for (size_t i = 0; i < arestas.size(); ++i) {
+        Edge a = arestas[i];
+        if (a.v < 0 || a.v >= numV || a.w < 0 || a.w >= numV)
+            throw std::invalid_argument("WeightedGraph: vértice fora de [0, V)");
+        if (!directed && a.v > a.w) std::swap(a.v, a.w);
+        lote.push_back(Item{a, i});
+    }
+
+    // Ordenação estável por (v, w): a primeira ocorrência de cada par fica à frente
+    Parallel::stableSort(lote.begin(), lote.end(), [](const Item& x, const Item& y) {
+        return x.aresta.v != y.aresta.v ? x.aresta.v < y.aresta.v : x.aresta.w < y.aresta.w;
+    });
+
+    size_t unicos = 0;
+    for (size_t i = 0; i < lote.size(); ++i) {
+        const Edge& a = lote[i].aresta;
+        if (unicos > 0) {
+            Edge& anterior = lote[unicos - 1].aresta;
+            if (anterior.v == a.v && anterior.w == a.w) {
+                anterior.weight = combinarPeso(anterior.weight, a.weight, politica);
+                continue;
             }
         }
+        lote[unicos++] = lote[i];
     }
+    lote.resize(unicos);
+
+    // Pares já presentes são combinados no lugar; os novos ficam para depois
+    auto combinarExistente = [&](int v, int w, W peso) {
+        int pos = findEdge(v, w);
+        if (pos == -1) return false;
+        Edge& e = listaMutavel(v)[pos];
+        e.weight = combinarPeso(e.weight, peso, politica);
+        return true;
+    };
+    std::vector<Item> novas;
+    std::vector<int> donos;  // uma entrada por posição nova em cada lista
+    for (const Item& item : lote) {
+        const Edge& a = item.aresta;
+        bool existe = combinarExistente(a.v, a.w, a.weight);
+        if (!directed && a.v != a.w) existe = combinarExistente(a.w, a.v, a.weight) && existe;
+        if (existe) continue;
+        novas.push_back(item);
+        donos.push_back(a.v);
+        if (!directed && a.v != a.w) donos.push_back(a.w);
+    }
+
+    // Reserva exata: cada lista que recebe arestas cresce uma única vez
+    std::sort(donos.begin(), donos.end());
+    for (size_t i = 0; i < donos.size();) {
+        size_t j = i;
+        while (j < donos.size() && donos[j] == donos[i]) ++j;
+        Lista& l = listaMutavel(donos[i]);
+        l.reserve(l.size() + (j - i));
+        i = j;
+    }
+
+    // Novas arestas na ordem da entrada, como uma sequência de insertEdge
+    std::sort(novas.begin(), novas.end(), [](const Item& x, const Item& y) { return x.indice < y.indice; });
+    for (const Item& item : novas) {
+        const Edge& a = item.aresta;
+        if (findEdge(a.v, a.w) == -1) appendEdge(a.v, a.w, a.weight);
+        if (!directed && a.v != a.w && findEdge(a.w, a.v) == -1) appendEdge(a.w, a.v, a.weight);
+    }
+    invalidarEntrada();
 }
 
-bool WeightedGraph::updateWeight(int v, int w, double novoPeso) {
-    for (auto& aresta : adj[v]) {
-        if (aresta.w == w) {
-            aresta.weight = novoPeso;
-            return true;
-        }
+template <typename W>
+void BasicWeightedGraph<W>::removeEdge(int v, int w) {
+    int pos = findEdge(v, w);
+    if (pos != -1) eraseEdgeAt(v, pos);
+    if (!directed) {
+        pos = findEdge(w, v);
+        if (pos != -1) eraseEdgeAt(w, pos);
+    }
+}
+
+template <typename W>
+bool BasicWeightedGraph<W>::updateWeight(int v, int w, W novoPeso) {
+    int pos = findEdge(v, w);
+    if (pos != -1) {
+        listaMutavel(v)[pos].weight = novoPeso;
+        invalidarEntrada();
+        return true;
     }
     if(!directed){
-        for (auto& aresta : adj[w]) {
-            if (aresta.w == v) {
-                aresta.weight = novoPeso;
-                return true;
-            }
+        pos = findEdge(w, v);
+        if (pos != -1) {
+            listaMutavel(w)[pos].weight = novoPeso;
+            invalidarEntrada();
+            return true;
         }
     }
     return false; 
 }
 
-bool WeightedGraph::hasEdge(int v, int w) const {
-    for (const auto& aresta : adj[v]) {
-        if (aresta.w == w) return true;
+template <typename W>
+bool BasicWeightedGraph<W>::hasEdge(int v, int w) const {
+    return findEdge(v, w) != -1;
+}
+
+template <typename W>
+std::optional<W> BasicWeightedGraph<W>::getWeight(int v, int w) const {
+    int pos = findEdge(v, w);
+    if (pos != -1) {
+        return lista(v)[pos].weight;
     }
-    return false;
+    return std::nullopt;
 }
 
-double WeightedGraph::getWeight(int v, int w) const {
-    for(const auto& aresta : adj[v]){
-        if(aresta.w == w){
-            return aresta.weight;
-        }
+template <typename W>
+int BasicWeightedGraph<W>::degree(int v) const {
+    return (int)lista(v).size();
+}
+
+template <typename W>
+size_t BasicWeightedGraph<W>::memoryUsage() const {
+    // Blocos compartilhados com outras versões também são contados
+    size_t bytes = sizeof(*this) + sizeof(Diretorio) + diretorio->blocos.capacity() * sizeof(std::shared_ptr<Bloco>);
+    for (const auto& bloco : diretorio->blocos) {
+        bytes += sizeof(Bloco) + bloco->listas.capacity() * sizeof(Lista);
+        for (const auto& l : bloco->listas) bytes += l.capacity() * sizeof(Edge);
     }
-    return -1;
+    bytes += inOffsets.capacity() * sizeof(int) + inAdj.capacity() * sizeof(Edge);
+    return bytes + indice.memoryUsage();
+}
+
+template <typename W>
+GraphStats BasicWeightedGraph<W>::stats() const {
+    GraphStats s = GraphStats::compute(numV, numE, directed, true, [this](int v, auto&& visitar) {
+        for (const auto& e : lista(v)) visitar(e.w, (double)e.weight);
+    });
+    s.memoryBytes = memoryUsage();
+    return s;
+}
+
+// Ordenação por contagem pelo destino: estável, logo cada lista de entrada segue a ordem das origens
+template <typename W>
+void BasicWeightedGraph<W>::buildInEdges() const {
+    inOffsets.assign(numV + 1, 0);
+    for (int v = 0; v < numV; ++v) {
+        for (const auto& e : lista(v)) inOffsets[e.w + 1]++;
+    }
+    for (int v = 0; v < numV; ++v) inOffsets[v + 1] += inOffsets[v];
+
+    inAdj.resize(inOffsets[numV]);
+    std::vector<int> pos(inOffsets.begin(), inOffsets.end() - 1);
+    for (int v = 0; v < numV; ++v) {
+        for (const auto& e : lista(v)) inAdj[pos[e.w]++] = e;
+    }
+    entrada.valido.store(true, std::memory_order_release);
+}
+
+template <typename W>
+std::span<const typename BasicWeightedGraph<W>::Edge> BasicWeightedGraph<W>::inEdges(int v) const {
+    if (!entrada.valido.load(std::memory_order_acquire)) {
+        std::lock_guard<std::mutex> guarda(entrada.trava);
+        if (!entrada.valido.load(std::memory_order_relaxed)) buildInEdges();
+    }
+    return std::span<const Edge>(inAdj.data() + inOffsets[v], inAdj.data() + inOffsets[v + 1]);
 }
 
-WeightedGraph::AdjIterator::AdjIterator(const WeightedGraph& G, int v)
+template <typename W>
+BasicWeightedGraph<W>::AdjIterator::AdjIterator(const BasicWeightedGraph& G, int v)
     : G(G), v(v), index(0) {}
 
-WeightedEdge WeightedGraph::AdjIterator::begin() {
+template <typename W>
+typename BasicWeightedGraph<W>::Edge BasicWeightedGraph<W>::AdjIterator::begin() {
     index = 0;
     return next();
 }
 
-WeightedEdge WeightedGraph::AdjIterator::next() {
-    if (index < (int)G.adj[v].size())
-        return G.adj[v][index++];
+template <typename W>
+typename BasicWeightedGraph<W>::Edge BasicWeightedGraph<W>::AdjIterator::next() {
+    if (index < G.degree(v))
+        return G.lista(v)[index++];
     else
-        return WeightedEdge(-1, -1, -1);
+        return Edge(-1, -1, W(-1));
 }
 
-bool WeightedGraph::AdjIterator::end() {
-    return index >= (int)G.adj[v].size();
+template <typename W>
+bool BasicWeightedGraph<W>::AdjIterator::end() const {
+    return index >= G.degree(v);
 }
 
+#define INSTANCIAR_GRAFO(W) template class BasicWeightedGraph<W>;
+FOR_EACH_WEIGHT_TYPE(INSTANCIAR_GRAFO)
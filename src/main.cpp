@@ -1,6 +1,18 @@
 #include "ImageSegmentation.h"
+#include "EdgeListReader.h"
+#include "KruskalMST.h"
+#include "BoruvkaMST.h"
+#include "PrimMST.h"
+#include "EdmondsMST.h"
+#include "TarjanMST.h"
+#include "GabowMST.h"
+#include "StrategyRunner.h"
+#include "Parallel.h"
+#include <chrono>
 #include <iostream>
+#include <stdexcept>
 #include <string>
+#include <vector>
 #include <cstring>
 
 // Função auxiliar para imprimir ajuda
@@ -10,9 +22,74 @@ void printUsage(const char* progName) {
               << "  -t, --threshold <valor>  Define o limiar de corte final (Padrao: 200.0)\n"
               << "  -p, --pre <valor>        Define o limiar dos superpixels (Padrao: 40.0)\n"
               << "  --no-blur                Desativa a suavizacao inicial\n"
+              << "  -o, --ordem <nome>       Renumera os superpixels: original, bfs, rcm, grau, hilbert\n"
+              << "  -g, --grafo <arquivo>    Executa os algoritmos sobre uma lista de arestas\n"
+              << "                           (SNAP \"u v w\", DIMACS .gr ou .csv) em vez de uma imagem\n"
+              << "  -c, --concorrente        Com --grafo: executa os algoritmos em paralelo\n"
+              << "                           sobre um unico grafo compartilhado\n"
               << std::endl;
 }
 
+// Executa os algoritmos sobre um grafo lido de arquivo e mostra custo e tempo de cada um.
+// Com `concorrente`, todos rodam ao mesmo tempo sobre o grafo direcionado (ver StrategyRunner)
+int executarGrafo(const std::string& caminho, bool concorrente) {
+    using Relogio = std::chrono::high_resolution_clock;
+    try {
+        auto inicio = Relogio::now();
+        // Arquivo lido uma vez; a versão não-direcionada guarda cada aresta uma só vez
+        int numVertices = 0;
+        std::vector<WeightedEdge> arestas = EdgeListReader::read<double>(caminho, numVertices);
+        UndirectedGraph naoDirecionado(numVertices);
+        naoDirecionado.insertEdges(arestas);
+        WeightedGraph direcionado(numVertices, true);
+        direcionado.insertEdges(arestas);
+        std::chrono::duration<double> leitura = Relogio::now() - inicio;
+        std::cout << "[" << caminho << "] " << direcionado.V() << " vertices, "
+                  << direcionado.E() << " arcos (leitura: " << leitura.count() << "s)" << std::endl;
+
+        if (concorrente) {
+            const Strategy estrategias[] = {Strategy::KRUSKAL_MST, Strategy::BORUVKA_MST, Strategy::PRIM_MST,
+                                            Strategy::AUTO_MST, Strategy::EDMONDS_MSA, Strategy::TARJAN_MSA,
+                                            Strategy::GABOW_MSA};
+            auto t0 = Relogio::now();
+            auto execucoes = StrategyRunner::runConcurrently<double>(direcionado, estrategias, 0);
+            std::chrono::duration<double> total = Relogio::now() - t0;
+            for (const auto& ex : execucoes) {
+                std::cout << StrategyRunner::name(ex.strategy);
+                if (ex.motor != ex.strategy) std::cout << " -> " << StrategyRunner::name(ex.motor);
+                std::cout << ": custo " << ex.resultado.totalCost << ", "
+                          << ex.resultado.numEdges() << " arestas, " << ex.segundos << "s" << std::endl;
+            }
+            std::cout << "Total (concorrente, " << Parallel::numThreads() << " threads): "
+                      << total.count() << "s" << std::endl;
+            return 0;
+        }
+
+        auto medir = [](const char* nome, auto executar) {
+            auto t0 = Relogio::now();
+            auto resultado = executar();
+            std::chrono::duration<double> dt = Relogio::now() - t0;
+            std::cout << nome << ": custo " << resultado.totalCost << ", "
+                      << resultado.numEdges() << " arestas, " << dt.count() << "s" << std::endl;
+        };
+        medir("Kruskal (MST)", [&] { return KruskalMST::obterFlorestaGeradora(naoDirecionado); });
+        medir("Boruvka (MST)", [&] { return BoruvkaMST::obterFlorestaGeradora(naoDirecionado); });
+        medir("Prim (MST)", [&] { return PrimMST::obterFlorestaGeradora(naoDirecionado); });
+
+        // Modo automático: o motor que o StrategyRunner escolhe aparece no nome da linha
+        Strategy motor = StrategyRunner::resolve(naoDirecionado, Strategy::AUTO_MST);
+        std::string nomeAuto = std::string("Auto (MST) -> ") + StrategyRunner::name(motor);
+        medir(nomeAuto.c_str(), [&] { return StrategyRunner::run(naoDirecionado, motor); });
+        medir("Edmonds (MSA)", [&] { return EdmondsMST::obterPaisArborescencia(direcionado, 0); });
+        medir("Tarjan (MSA)", [&] { return TarjanMST::obterPaisArborescencia(direcionado, 0); });
+        medir("Gabow (MSA)", [&] { return GabowMST::obterPaisArborescencia(direcionado, 0); });
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
 int main(int argc, char** argv) {
     // 1. Caminho da Imagem
     std::string inputImage = (argc > 1 && argv[1][0] != '-') ? argv[1] : "img/input.jpg";
@@ -32,6 +109,9 @@ int main(int argc, char** argv) {
     // 40.0 ajuda a ignorar variações dentro do mesmo objeto.
     opts.minSuperpixelSize = 10.0; 
 
+    std::string arquivoGrafo;
+    bool concorrente = false;
+
     // 3. Parsing de Argumentos
     for (int i = 1; i < argc; ++i) {
         if (std::strcmp(argv[i], "--threshold") == 0 || std::strcmp(argv[i], "-t") == 0) {
@@ -41,6 +121,27 @@ int main(int argc, char** argv) {
             // Permite ajustar o tamanho do superpixel via terminal
             if (i + 1 < argc) opts.minSuperpixelSize = std::stod(argv[++i]);
         }
+        else if (std::strcmp(argv[i], "--grafo") == 0 || std::strcmp(argv[i], "-g") == 0) {
+            if (i + 1 < argc) arquivoGrafo = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--concorrente") == 0 || std::strcmp(argv[i], "-c") == 0) {
+            concorrente = true;
+        }
+        else if (std::strcmp(argv[i], "--ordem") == 0 || std::strcmp(argv[i], "-o") == 0) {
+            if (i + 1 < argc) {
+                std::string nome = argv[++i];
+                if (nome == "bfs") opts.ordering = Ordering::BFS;
+                else if (nome == "rcm") opts.ordering = Ordering::RCM;
+                else if (nome == "grau") opts.ordering = Ordering::DEGREE;
+                else if (nome == "hilbert") opts.ordering = Ordering::HILBERT;
+                else if (nome == "original") opts.ordering = Ordering::ORIGINAL;
+                else {
+                    std::cerr << "Ordem desconhecida: " << nome << std::endl;
+                    printUsage(argv[0]);
+                    return 1;
+                }
+            }
+        }
         else if (std::strcmp(argv[i], "--no-blur") == 0) {
             opts.enableBlur = false;
         }
@@ -50,6 +151,8 @@ int main(int argc, char** argv) {
         }
     }
 
+    if (!arquivoGrafo.empty()) return executarGrafo(arquivoGrafo, concorrente);
+
     std::cout << "=== CONFIGURACAO DE SEGMENTACAO ===" << std::endl;
     std::cout << "Imagem Entrada: " << inputImage << std::endl;
     std::cout << "Threshold Final (-t): " << threshold << std::endl;
@@ -57,19 +160,28 @@ int main(int argc, char** argv) {
     std::cout << "Suavizacao (Blur): " << (opts.enableBlur ? "ATIVADO" : "DESATIVADO") << std::endl;
     std::cout << "===================================" << std::endl << std::endl;
 
-    // Executa os 4 algoritmos em sequência
+    // Executa os 6 algoritmos em sequência, mais o modo automático (o motor escolhido sai no log)
     
     std::cout << "--- 1. KRUSKAL (MST) ---" << std::endl;
     ImageSegmentation::runSegmentation(inputImage, "img/out_kruskal.png", Strategy::KRUSKAL_MST, threshold, opts);
 
-    std::cout << "\n--- 2. EDMONDS (MSA) ---" << std::endl;
+    std::cout << "\n--- 2. BORUVKA (MST) ---" << std::endl;
+    ImageSegmentation::runSegmentation(inputImage, "img/out_boruvka.png", Strategy::BORUVKA_MST, threshold, opts);
+
+    std::cout << "\n--- 3. PRIM (MST) ---" << std::endl;
+    ImageSegmentation::runSegmentation(inputImage, "img/out_prim.png", Strategy::PRIM_MST, threshold, opts);
+
+    std::cout << "\n--- 4. AUTOMATICO (MST) ---" << std::endl;
+    ImageSegmentation::runSegmentation(inputImage, "img/out_auto.png", Strategy::AUTO_MST, threshold, opts);
+
+    std::cout << "\n--- 5. EDMONDS (MSA) ---" << std::endl;
     // Graças aos Superpixels, Edmonds agora deve rodar em tempo aceitável
     ImageSegmentation::runSegmentation(inputImage, "img/out_edmonds.png", Strategy::EDMONDS_MSA, threshold, opts);
 
-    std::cout << "\n--- 3. TARJAN (MSA) ---" << std::endl;
+    std::cout << "\n--- 6. TARJAN (MSA) ---" << std::endl;
     ImageSegmentation::runSegmentation(inputImage, "img/out_tarjan.png", Strategy::TARJAN_MSA, threshold, opts);
 
-    std::cout << "\n--- 4. GABOW (MSA) ---" << std::endl;
+    std::cout << "\n--- 7. GABOW (MSA) ---" << std::endl;
     ImageSegmentation::runSegmentation(inputImage, "img/out_gabow.png", Strategy::GABOW_MSA, threshold, opts);
 
     std::cout << "\nConcluido! Verifique a pasta img/." << std::endl;
@@ -0,0 +1,87 @@
+#ifndef TEST_HELPERS_H
+#define TEST_HELPERS_H
+
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "SpanningResult.h"
+
+// Verificações contadas: o binário de teste sai com código != 0 se alguma falhar
+inline int falhas = 0;
+
+inline void conferir(const std::string& descricao, bool ok) {
+    std::cout << (ok ? "  ok    " : "  FALHA ") << descricao << std::endl;
+    if (!ok) falhas++;
+}
+
+// Resumo final e código de saída do main
+inline int resultadoFinal() {
+    std::cout << "\n" << (falhas == 0 ? "Todas as verificacoes passaram"
+                                      : std::to_string(falhas) + " verificacao(oes) falharam")
+              << std::endl;
+    return falhas == 0 ? 0 : 1;
+}
+
+// Vetor de pais de uma arborescência ou floresta, uma aresta por linha, e o custo total
+inline void imprimirPais(const BasicSpanningResult<double>& r) {
+    std::cout << "--- Vetor de Pais ---" << std::endl;
+    for (int v = 0; v < r.V(); ++v) {
+        if (r.parent[v] == -1) continue;
+        std::cout << r.parent[v] << " -> " << v << " [Peso: " << r.parentWeight[v] << ", aresta #" << r.edgeId[v] << "]" << std::endl;
+    }
+    std::cout << "Peso Total: " << r.totalCost << std::endl;
+}
+
+// Arestas de um grafo não direcionado (cada uma uma vez) e o peso total
+inline void imprimirGrafo(const WeightedGraph& g) {
+    double pesoTotal = 0;
+    std::cout << "--- Estrutura do Grafo ---" << std::endl;
+    for (const WeightedEdge& e : g.edges()) {
+        if (e.v < e.w) {
+            std::cout << e.v << " - " << e.w << " [Peso: " << e.weight << "]" << std::endl;
+            pesoTotal += e.weight;
+        }
+    }
+    std::cout << "Peso Total: " << pesoTotal << std::endl;
+    std::cout << "--------------------------" << std::endl;
+}
+
+// Grafo não direcionado de 6 vértices com empates de peso, comum aos testes de MST
+inline WeightedGraph grafoExemplo() {
+    WeightedGraph grafo(6, false);
+    grafo.insertEdge(0, 1, 4.0);
+    grafo.insertEdge(0, 2, 4.0);
+    grafo.insertEdge(1, 2, 2.0);
+    grafo.insertEdge(2, 3, 3.0);
+    grafo.insertEdge(2, 5, 2.0);
+    grafo.insertEdge(2, 4, 4.0);
+    grafo.insertEdge(3, 4, 3.0);
+    grafo.insertEdge(5, 4, 3.0);
+    return grafo;
+}
+
+/**
+ * Grafo não direcionado aleatório de n vértices: `tentativas` arestas sorteadas entre os
+ * `usados` primeiros vértices (os demais ficam isolados, o grafo sai desconexo), laços
+ * descartados, pesos (0..pesosDistintos-1) / divisor com muitos empates.
+ */
+inline UndirectedGraph grafoAleatorio(unsigned semente, int n, int tentativas, int usados,
+                                      int pesosDistintos, double divisor = 1.0) {
+    std::mt19937 rng(semente);
+    std::vector<WeightedEdge> arestas;
+    for (int i = 0; i < tentativas; ++i) {
+        int a = (int)(rng() % usados), b = (int)(rng() % usados);
+        if (a != b) arestas.push_back(WeightedEdge(a, b, (double)(rng() % pesosDistintos) / divisor));
+    }
+    UndirectedGraph grafo(n);
+    grafo.insertEdges(arestas);
+    return grafo;
+}
+
+// Mesmas arestas escolhidas (pais e posições na entrada)
+inline bool mesmaFloresta(const SpanningForestResult& a, const SpanningForestResult& b) {
+    return a.parent == b.parent && a.edgeId == b.edgeId;
+}
+
+#endif // TEST_HELPERS_H
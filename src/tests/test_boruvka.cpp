@@ -0,0 +1,44 @@
+#include <iostream>
+#include "BoruvkaMST.h"
+#include "KruskalMST.h"
+#include "CSRGraph.h"
+#include "UndirectedGraph.h"
+#include "Parallel.h"
+#include "TestHelpers.h"
+
+using namespace std;
+
+int main() {
+    cout << "=== Teste Algoritmo de Boruvka ===" << endl;
+
+    // Mesmo grafo do teste do Kruskal (com empates de peso)
+    WeightedGraph grafo = grafoExemplo();
+
+    WeightedGraph mst = BoruvkaMST::obterArvoreGeradoraMinima(grafo);
+    cout << "\nGrafo MST (Boruvka):" << endl;
+    imprimirGrafo(mst);
+
+    cout << "\nFloresta MST como vetor de pais (fotografia CSR):" << endl;
+    CSRGraph csr(grafo);
+    SpanningForestResult pequena = BoruvkaMST::obterFlorestaGeradora(csr);
+    imprimirPais(pequena);
+    conferir("mesma floresta do Kruskal no grafo de exemplo",
+             mesmaFloresta(pequena, KruskalMST::obterFlorestaGeradora(csr)));
+
+    // Grafo maior, desconexo e com muitos empates: a floresta deve ser a do Kruskal
+    // para qualquer número de threads
+    int n = 20000;
+    UndirectedGraph grande = grafoAleatorio(42, n, 4 * n, n - 100, 50);
+    SpanningForestResult kruskal = KruskalMST::obterFlorestaGeradora(grande);
+
+    for (int threads : {1, 4}) {
+        Parallel::setNumThreads(threads);
+        SpanningForestResult boruvka = BoruvkaMST::obterFlorestaGeradora(grande);
+        cout << "\n" << grande.V() << " vertices, " << grande.E() << " arestas, " << threads << " thread(s): custo "
+             << boruvka.totalCost << " (Kruskal " << kruskal.totalCost << ")" << endl;
+        conferir("mesma floresta do Kruskal com " + to_string(threads) + " thread(s)", mesmaFloresta(boruvka, kruskal));
+    }
+    Parallel::setNumThreads(0);
+
+    return resultadoFinal();
+}
@@ -1,27 +1,64 @@
 #include <iostream>
+#include <cstdio>
 #include "WeightedGraph.h"
 #include "EdmondsMST.h"
+#include "GraphFile.h"
+#include "CSRGraph.h"
+#include "CompressedGraph.h"
+#include "StrategyRunner.h"
+#include "EdgeArrays.h"
+#include "TestHelpers.h"
 #include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <string>
 
 using namespace std;
 
 void imprimirResultado(WeightedGraph& g) {
     double pesoTotal = 0;
     cout << "--- Arborescencia Gerada ---" << endl;
-    for (int i = 0; i < g.V(); ++i) {
-        WeightedGraph::AdjIterator it(g, i);
-        WeightedEdge e = it.begin();
-        while (e.v != -1) {
-            cout << e.v << " -> " << e.w << " [Peso: " << e.weight << "]" << endl;
-            pesoTotal += e.weight;
-            if (it.end()) break;
-            e = it.next();
-        }
+    for (const WeightedEdge& e : g.edges()) {
+        cout << e.v << " -> " << e.w << " [Peso: " << e.weight << "]" << endl;
+        pesoTotal += e.weight;
     }
     cout << "Peso Total da Arborescencia: " << pesoTotal << endl;
     cout << "----------------------------" << endl;
 }
 
+// Menor peso que entra em cada vértice por laço simples; empate fica com o menor índice
+template <typename W>
+vector<int> menorEntradaReferencia(const BasicEdgeArrays<W>& arestas, int raiz) {
+    vector<int> melhor(arestas.V(), -1);
+    for (int e = 0; e < arestas.E(); ++e) {
+        int v = arestas.target(e);
+        if (v == raiz || arestas.source(e) == v) continue;
+        if (melhor[v] == -1 || arestas.weight(e) < arestas.weight(melhor[v])) melhor[v] = e;
+    }
+    return melhor;
+}
+
+// cheapestIncoming (AVX2 quando disponível) contra a referência: poucos vértices e poucos
+// pesos, para que um bloco de 8 arestas tenha vários destinos repetidos e empates
+template <typename W>
+void testarMenorEntrada(const string& tipo) {
+    mt19937 rng(42);
+    bool iguais = true;
+    for (int rodada = 0; rodada < 200 && iguais; ++rodada) {
+        int n = 2 + (int)(rng() % 12);
+        int m = (int)(rng() % 300);
+        int raiz = (int)(rng() % n);
+        BasicEdgeArrays<W> arestas(n);
+        for (int e = 0; e < m; ++e) arestas.push_back((int)(rng() % n), (int)(rng() % n), W(rng() % 4));
+        vector<int> obtido;
+        arestas.cheapestIncoming(raiz, obtido);
+        iguais = obtido == menorEntradaReferencia(arestas, raiz);
+    }
+    conferir("cheapestIncoming<" + tipo + "> == menor peso por destino (200 listas sorteadas)", iguais);
+}
+
 int main() {
     cout << "=== Teste: Algoritmo de Edmonds (Chu-Liu) ===" << endl;
 
@@ -51,5 +88,104 @@ int main() {
     WeightedGraph arborescencia2 = EdmondsMST::obterArborescencia(grafo2, 0);
     imprimirResultado(arborescencia2);
 
-    return 0;
+    cout << "\n--- Teste 3: Mesmo grafo via fotografia CSR ---" << endl;
+    CSRGraph csr(grafo);
+    WeightedGraph arborescenciaCSR = EdmondsMST::obterArborescencia(csr, 0);
+    imprimirResultado(arborescenciaCSR);
+
+    cout << "\n--- Teste 4: Resultado como vetor de pais ---" << endl;
+    imprimirPais(EdmondsMST::obterPaisArborescencia(csr, 0));
+
+    cout << "\n--- Teste 5: Grafo salvo em binario e mapeado (mmap) ---" << endl;
+    GraphFile::write("test_edmonds_grafo.bin", grafo);
+    CSRGraph mapeado = GraphFile::map<double>("test_edmonds_grafo.bin", true);
+    WeightedGraph arborescenciaMapeada = EdmondsMST::obterArborescencia(mapeado, 0);
+    imprimirResultado(arborescenciaMapeada);
+    double custoEmMemoria = EdmondsMST::obterPaisArborescencia(grafo, 0).totalCost;
+    conferir("CSR mapeado: custo 12, o mesmo do grafo em memoria",
+             custoEmMemoria == 12.0 && EdmondsMST::obterPaisArborescencia(mapeado, 0).totalCost == custoEmMemoria);
+
+    // Arquivos corrompidos: offsets[V] é recusado mesmo sem verificação (O(1)); o resto
+    // da estrutura só com verificarChecksum. Após o cabeçalho de 64 bytes vêm os V + 1
+    // offsets e, no múltiplo de 8 seguinte, os destinos
+    streamoff inicioOffsets = 64;
+    streamoff inicioDestinos = (inicioOffsets + (grafo.V() + 1) * (streamoff)sizeof(int32_t) + 7) / 8 * 8;
+    struct Corrupcao {
+        const char* campo;
+        streamoff posicao;
+        int32_t valor;
+        bool verificar;
+    };
+    const Corrupcao corrupcoes[] = {
+        {"offsets[V]", inicioOffsets + grafo.V() * (streamoff)sizeof(int32_t), grafo.E() + 5, false},
+        {"offsets[2] (interno, decrescente)", inicioOffsets + 2 * (streamoff)sizeof(int32_t), grafo.E(), true},
+        {"targets[2] (fora de [0, V))", inicioDestinos + 2 * (streamoff)sizeof(int32_t), grafo.V() + 3, true},
+    };
+    for (const Corrupcao& c : corrupcoes) {
+        GraphFile::write("test_edmonds_grafo.bin", grafo);
+        {
+            fstream arquivo("test_edmonds_grafo.bin", ios::in | ios::out | ios::binary);
+            arquivo.seekp(c.posicao);
+            arquivo.write(reinterpret_cast<const char*>(&c.valor), sizeof(c.valor));
+        }
+        bool recusado = false;
+        try {
+            GraphFile::map<double>("test_edmonds_grafo.bin", c.verificar);
+        } catch (const runtime_error& e) {
+            cout << "Arquivo corrompido recusado: " << e.what() << endl;
+            recusado = true;
+        }
+        conferir(string(c.campo) + " corrompido recusado" + (c.verificar ? " com verificacao" : " sem verificacao"),
+                 recusado);
+    }
+    remove("test_edmonds_grafo.bin");
+
+    cout << "\n--- Teste 6: Adjacencia comprimida (varint) ---" << endl;
+    CompressedGraph comprimido(grafo);
+    cout << comprimido.E() << " arcos em " << comprimido.memoryUsage() << " bytes" << endl;
+    ArborescenceResult arborescenciaComprimida = EdmondsMST::obterPaisArborescencia(comprimido, 0);
+    imprimirPais(arborescenciaComprimida);
+    conferir("E() do comprimido == E() do grafo", comprimido.E() == grafo.E());
+    conferir("custo no comprimido == custo no WeightedGraph", arborescenciaComprimida.totalCost == custoEmMemoria);
+
+    cout << "\n--- Teste 7: Estrategias concorrentes sobre o mesmo grafo (const) ---" << endl;
+    const WeightedGraph& compartilhado = grafo;
+    const Strategy estrategias[] = {Strategy::EDMONDS_MSA, Strategy::TARJAN_MSA, Strategy::GABOW_MSA};
+    auto execucoes = StrategyRunner::runConcurrently<double>(compartilhado, estrategias, 0);
+    conferir("uma execucao por estrategia", execucoes.size() == 3);
+    for (const auto& ex : execucoes) {
+        cout << StrategyRunner::name(ex.strategy) << ": custo " << ex.resultado.totalCost << endl;
+        conferir(string(StrategyRunner::name(ex.strategy)) + ": sucesso e custo do Edmonds sequencial",
+                 ex.resultado.success && ex.resultado.totalCost == custoEmMemoria);
+    }
+
+    cout << "\n--- Teste 8: Versao anterior preservada por snapshot() ---" << endl;
+    // Mais de um bloco de 256 vértices: a escrita em 0 só pode copiar o primeiro
+    int n = 600;
+    WeightedGraph versionado(n, true);
+    for (int v = 1; v < n; ++v) {
+        versionado.insertEdge(0, v, 100.0);
+        if (v + 1 < n) versionado.insertEdge(v, v + 1, 1.0);
+    }
+    WeightedGraph versaoAnterior = versionado.snapshot();
+    versionado.updateWeight(0, 1, 1.0);
+    int compartilhados = versionado.sharedBlocks(versaoAnterior);
+    cout << "Blocos: " << versionado.blockCount() << ", compartilhados apos updateWeight(0, 1, 1.0): "
+         << compartilhados << endl;
+    conferir("so o bloco escrito e copiado", versionado.blockCount() > 1 &&
+                                                  compartilhados == versionado.blockCount() - 1);
+    conferir("peso de 0 -> 1: versao anterior 100, atual 1",
+             *versaoAnterior.getWeight(0, 1) == 100.0 && *versionado.getWeight(0, 1) == 1.0);
+    double custoAnterior = EdmondsMST::obterPaisArborescencia(versaoAnterior, 0).totalCost;
+    double custoAtual = EdmondsMST::obterPaisArborescencia(versionado, 0).totalCost;
+    cout << "Custos: versao anterior " << custoAnterior << ", atual " << custoAtual << endl;
+    conferir("versao anterior: custo 698", custoAnterior == 698.0);
+    conferir("versao atual: custo 599", custoAtual == 599.0);
+
+    cout << "\n--- Teste 9: cheapestIncoming contra a referencia escalar ---" << endl;
+#define TESTAR_MENOR_ENTRADA(W) testarMenorEntrada<W>(#W);
+    FOR_EACH_WEIGHT_TYPE(TESTAR_MENOR_ENTRADA)
+#undef TESTAR_MENOR_ENTRADA
+
+    return resultadoFinal();
 }
\ No newline at end of file
@@ -1,21 +1,19 @@
 #include <iostream>
 #include "WeightedGraph.h"
 #include "GabowMST.h"
+#include "EdmondsMST.h"
+#include "CSRGraph.h"
+#include "TestHelpers.h"
+#include <vector>
 
 using namespace std;
 
 void imprimirGabow(WeightedGraph& g) {
     double total = 0;
     cout << "--- Arborescencia (Gabow) ---" << endl;
-    for (int i = 0; i < g.V(); ++i) {
-        WeightedGraph::AdjIterator it(g, i);
-        WeightedEdge e = it.begin();
-        while (e.v != -1) {
-            cout << e.v << " -> " << e.w << " [Peso: " << e.weight << "]" << endl;
-            total += e.weight;
-            if (it.end()) break;
-            e = it.next();
-        }
+    for (const WeightedEdge& e : g.edges()) {
+        cout << e.v << " -> " << e.w << " [Peso: " << e.weight << "]" << endl;
+        total += e.weight;
     }
     cout << "Peso Total: " << total << endl;
     cout << "-----------------------------" << endl;
@@ -38,5 +36,48 @@ int main() {
     WeightedGraph mst = GabowMST::obterArborescencia(g, 0);
     imprimirGabow(mst);
 
-    return 0;
+    cout << "\n=== Mesmo grafo via fotografia CSR ===" << endl;
+    CSRGraph csr(g);
+    WeightedGraph mstCSR = GabowMST::obterArborescencia(csr, 0);
+    imprimirGabow(mstCSR);
+
+    cout << "\n=== Mesmo grafo como vetor de pais ===" << endl;
+    ArborescenceResult pais4 = GabowMST::obterPaisArborescencia(csr, 0);
+    imprimirPais(pais4);
+    conferir("custo 12 com pais {-, 3, 0, 2}",
+             pais4.success && pais4.totalCost == 12.0 && pais4.parent == vector<int>{-1, 3, 0, 2});
+
+    // Ciclo de 4 vértices mais barato que qualquer entrada: a contração precisa juntar
+    // o ciclo inteiro, não só as duas pontas da aresta que o fechou
+    cout << "\n=== Ciclo 1 -> 2 -> 3 -> 4 -> 1 ===" << endl;
+    WeightedGraph ciclo(5, true);
+    ciclo.insertEdge(1, 2, 1.0);
+    ciclo.insertEdge(2, 3, 1.0);
+    ciclo.insertEdge(3, 4, 1.0);
+    ciclo.insertEdge(4, 1, 1.0);
+    ciclo.insertEdge(0, 1, 10.0);
+    ciclo.insertEdge(0, 3, 12.0);
+    ciclo.insertEdge(0, 2, 15.0);
+    WeightedGraph gabowCiclo = GabowMST::obterArborescencia(ciclo, 0);
+    imprimirGabow(gabowCiclo);
+
+    double custo = 0;
+    vector<int> pais(ciclo.V(), -1);
+    int entradas = 0;
+    for (const WeightedEdge& e : gabowCiclo.edges()) {
+        custo += e.weight;
+        pais[e.w] = e.v;
+        entradas++;
+    }
+    double custoEdmonds = 0;
+    WeightedGraph edmondsCiclo = EdmondsMST::obterArborescencia(ciclo, 0);
+    for (const WeightedEdge& e : edmondsCiclo.edges()) custoEdmonds += e.weight;
+    conferir("custo 13, o mesmo do Edmonds", custo == 13.0 && custoEdmonds == 13.0);
+    conferir("uma aresta de entrada por vertice: pais {-, 0, 1, 2, 3}",
+             entradas == 4 && pais == vector<int>{-1, 0, 1, 2, 3});
+    ArborescenceResult paisCiclo = GabowMST::obterPaisArborescencia(ciclo, 0);
+    conferir("vetor de pais do ciclo: sucesso, custo 13 e os mesmos pais",
+             paisCiclo.success && paisCiclo.totalCost == 13.0 && paisCiclo.parent == pais);
+
+    return resultadoFinal();
 }
\ No newline at end of file
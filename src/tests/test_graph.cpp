@@ -0,0 +1,407 @@
+#include <algorithm>
+#include <iostream>
+#include <optional>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Graph.h"
+#include "WeightedGraph.h"
+#include "CSRGraph.h"
+#include "Parallel.h"
+#include "TestHelpers.h"
+
+using namespace std;
+
+using ListaArestas = vector<pair<int, int>>;
+
+ListaArestas arestasDe(const Graph& g) {
+    ListaArestas lista;
+    for (const Edge& e : g.edges()) lista.push_back({e.v, e.w});
+    return lista;
+}
+
+// Mesma lista percorrida com AdjIterator, vértice vivo a vértice vivo
+ListaArestas arestasPorIterador(const Graph& g) {
+    ListaArestas lista;
+    for (int v = 0; v < g.V(); ++v) {
+        if (g.isRemoved(v)) continue;
+        Graph::AdjIterator it(g, v);
+        for (Edge e = it.begin(); e.v >= 0; e = it.next()) lista.push_back({e.v, e.w});
+        if (!it.end()) lista.push_back({-1, -1});
+    }
+    return lista;
+}
+
+void imprimir(const ListaArestas& lista) {
+    for (const auto& [v, w] : lista) cout << " " << v << "->" << w;
+}
+
+// E(), edges() e AdjIterator contra o esperado
+void conferirGrafo(const string& etapa, const Graph& g, int esperadoE, const ListaArestas& esperadas) {
+    cout << etapa << ": V=" << g.V() << " vivos=" << g.liveVertices() << " E=" << g.E() << " |";
+    imprimir(arestasDe(g));
+    cout << endl;
+    conferir("E() == " + to_string(esperadoE), g.E() == esperadoE);
+    conferir("edges() pula vertices removidos e lapides", arestasDe(g) == esperadas);
+    conferir("AdjIterator percorre as mesmas arestas", arestasPorIterador(g) == esperadas);
+}
+
+// hasEdge, getWeight e E() de dois grafos em todos os pares (v, w)
+bool mesmasConsultas(const WeightedGraph& a, const WeightedGraph& b) {
+    if (a.E() != b.E()) return false;
+    for (int v = 0; v < a.V(); ++v) {
+        for (int w = 0; w < a.V(); ++w) {
+            if (a.hasEdge(v, w) != b.hasEdge(v, w) || a.getWeight(v, w) != b.getWeight(v, w)) return false;
+        }
+    }
+    return true;
+}
+
+// Inserções, remoções e atualizações sorteadas, com e sem o índice de arestas
+void testarIndiceArestas(bool direcionado) {
+    cout << "\n--- Indice de arestas (" << (direcionado ? "direcionado" : "nao direcionado") << ") ---" << endl;
+    const int n = 12;
+    WeightedGraph comIndice(n, direcionado), semIndice(n, direcionado);
+    comIndice.enableEdgeIndex();
+    mt19937 rng(direcionado ? 7 : 11);
+    bool iguais = true;
+    int remocoes = 0;
+    for (int passo = 0; passo < 4000 && iguais; ++passo) {
+        int v = (int)(rng() % n), w = (int)(rng() % n);
+        double peso = (double)(rng() % 50);
+        switch (rng() % 3) {
+            case 0:
+                comIndice.insertEdge(v, w, peso);
+                semIndice.insertEdge(v, w, peso);
+                break;
+            case 1:
+                remocoes += comIndice.hasEdge(v, w);
+                comIndice.removeEdge(v, w);
+                semIndice.removeEdge(v, w);
+                break;
+            default:
+                iguais = comIndice.updateWeight(v, w, peso) == semIndice.updateWeight(v, w, peso);
+                break;
+        }
+        iguais = iguais && mesmasConsultas(comIndice, semIndice);
+    }
+    cout << "E() final: " << comIndice.E() << ", remocoes efetivas: " << remocoes << endl;
+    conferir("4000 operacoes: hasEdge, getWeight e E() iguais com e sem indice", iguais);
+    conferir("mais de 100 remocoes efetivas", remocoes > 100);
+
+    // Reconstruído do zero sobre o estado final, o índice dá as mesmas respostas
+    semIndice.enableEdgeIndex();
+    conferir("enableEdgeIndex() sobre o estado final", mesmasConsultas(comIndice, semIndice));
+}
+
+// inEdges(v) de todos os vértices contra uma varredura das listas de saída em ordem de origem
+bool entradasConferem(const WeightedGraph& g) {
+    for (int v = 0; v < g.V(); ++v) {
+        vector<WeightedEdge> esperado;
+        for (int u = 0; u < g.V(); ++u) {
+            for (const WeightedEdge& e : g.neighbors(u)) {
+                if (e.w == v) esperado.push_back(e);
+            }
+        }
+        span<const WeightedEdge> obtido = g.inEdges(v);
+        if (!equal(obtido.begin(), obtido.end(), esperado.begin(), esperado.end(), [](const auto& a, const auto& b) {
+                return a.v == b.v && a.w == b.w && a.weight == b.weight;
+            }))
+            return false;
+    }
+    return true;
+}
+
+// A transposta é consultada antes e depois de cada tipo de mutação
+void testarArestasEntrada() {
+    cout << "\n--- inEdges reconstruido apos mutacoes ---" << endl;
+    WeightedGraph g(5, true);
+    g.insertEdge(3, 1, 2.0);
+    g.insertEdge(0, 1, 4.0);
+    g.insertEdge(1, 1, 1.0);
+    g.insertEdge(4, 2, 3.0);
+    conferir("inicial", entradasConferem(g));
+    conferir("entrada de 1 ordenada por origem: 0, 1, 3",
+             g.inEdges(1).size() == 3 && g.inEdges(1)[0].v == 0 && g.inEdges(1)[1].v == 1 && g.inEdges(1)[2].v == 3);
+
+    g.insertEdge(2, 1, 5.0);
+    conferir("insertEdge(2, 1)", entradasConferem(g) && g.inEdges(1).size() == 4);
+
+    g.removeEdge(0, 1);
+    conferir("removeEdge(0, 1)", entradasConferem(g) && g.inEdges(1)[0].v == 1);
+
+    g.updateWeight(3, 1, 9.0);
+    conferir("updateWeight(3, 1, 9)", entradasConferem(g) && g.inEdges(1).back().weight == 9.0);
+
+    vector<WeightedEdge> lote = {WeightedEdge(0, 4, 1.0), WeightedEdge(4, 2, 1.0), WeightedEdge(2, 4, 6.0)};
+    g.insertEdges(lote, DuplicatePolicy::KEEP_MIN);
+    conferir("insertEdges (novas e 4 -> 2 com peso menor)",
+             entradasConferem(g) && g.inEdges(4).size() == 2 && g.inEdges(2)[0].weight == 1.0);
+
+    WeightedGraph vazio(5, true);
+    vazio.inEdges(0);
+    vazio.insertEdges(lote);
+    conferir("insertEdges num grafo vazio ja consultado", entradasConferem(vazio));
+}
+
+// Mesmos offsets, destinos e pesos, bit a bit
+bool mesmoCSR(const CSRGraph& a, const CSRGraph& b) {
+    if (a.V() != b.V() || a.E() != b.E()) return false;
+    return equal(a.offsetData(), a.offsetData() + a.V() + 1, b.offsetData()) &&
+           equal(a.targetData(), a.targetData() + a.E(), b.targetData()) &&
+           equal(a.weightData(), a.weightData() + a.E(), b.weightData());
+}
+
+// Listas de adjacência na ordem da entrada, com repetições somadas na primeira ocorrência
+using ListasPonderadas = vector<vector<pair<int, double>>>;
+
+ListasPonderadas listasSerialSomando(int n, const vector<WeightedEdge>& arestas, bool direcionado) {
+    ListasPonderadas listas(n);
+    auto somar = [&](int v, int w, double peso) {
+        for (auto& [alvo, acumulado] : listas[v]) {
+            if (alvo == w) {
+                acumulado += peso;
+                return;
+            }
+        }
+        listas[v].push_back({w, peso});
+    };
+    for (const WeightedEdge& e : arestas) {
+        somar(e.v, e.w, e.weight);
+        if (!direcionado && e.v != e.w) somar(e.w, e.v, e.weight);
+    }
+    return listas;
+}
+
+bool mesmasListas(const CSRGraph& g, const ListasPonderadas& listas) {
+    for (int v = 0; v < g.V(); ++v) {
+        if (g.degree(v) != (int)listas[v].size()) return false;
+        for (int i = 0; i < g.degree(v); ++i) {
+            int e = g.firstEdge(v) + i;
+            if (g.target(e) != listas[v][i].first || g.weight(e) != listas[v][i].second) return false;
+        }
+    }
+    return true;
+}
+
+// fromEdges com 1 e 4 threads contra montagens seriais na ordem da entrada. Pesos
+// fracionários somados (SUM) dão resultados diferentes se as repetições forem combinadas
+// em outra ordem; com KEEP_FIRST a referência é um laço de insertEdge
+void testarFromEdgesDeterministico(bool direcionado) {
+    cout << "\n--- fromEdges com 1 e 4 threads (" << (direcionado ? "direcionado" : "nao direcionado") << ") ---" << endl;
+    const int n = 3000, m = 600000;
+    mt19937 rng(direcionado ? 3 : 5);
+    vector<WeightedEdge> arestas;
+    arestas.reserve(m);
+    for (int i = 0; i < m; ++i) {
+        int v = (int)(rng() % n);
+        int w = (v + (int)(rng() % 64)) % n;  // vizinhança curta: muitas repetições
+        arestas.push_back(WeightedEdge(v, w, (double)(rng() % 1000) / 7.0));
+    }
+
+    Parallel::setNumThreads(1);
+    CSRGraph umaThread = CSRGraph::fromEdges(n, arestas, direcionado, DuplicatePolicy::SUM);
+    Parallel::setNumThreads(4);
+    CSRGraph quatroThreads = CSRGraph::fromEdges(n, arestas, direcionado, DuplicatePolicy::SUM);
+    CSRGraph primeiraOcorrencia = CSRGraph::fromEdges(n, arestas, direcionado, DuplicatePolicy::KEEP_FIRST);
+    Parallel::setNumThreads(0);
+
+    WeightedGraph serial(n, direcionado);
+    for (const WeightedEdge& e : arestas) serial.insertEdge(e.v, e.w, e.weight);
+
+    cout << "E() = " << umaThread.E() << " a partir de " << m << " arestas" << endl;
+    conferir("SUM, 1 e 4 threads: mesmos offsets, destinos e pesos", mesmoCSR(umaThread, quatroThreads));
+    conferir("SUM: listas na ordem da entrada, somas na ordem da entrada",
+             mesmasListas(umaThread, listasSerialSomando(n, arestas, direcionado)));
+    conferir("KEEP_FIRST (4 threads) == laco serial de insertEdge", mesmoCSR(primeiraOcorrencia, CSRGraph(serial)));
+}
+
+const char* nomePolitica(DuplicatePolicy p) {
+    switch (p) {
+        case DuplicatePolicy::KEEP_MIN: return "KEEP_MIN";
+        case DuplicatePolicy::SUM: return "SUM";
+        case DuplicatePolicy::KEEP_FIRST: break;
+    }
+    return "KEEP_FIRST";
+}
+
+// Pesos esperados de 0-1 e do laço 2-2, num grafo vazio e fundindo com 0-1 (6) e 2-2 (3)
+struct PesosEsperados {
+    DuplicatePolicy politica;
+    double vazio01, fundido01, vazio22, fundido22;
+};
+
+// insertEdges com cada política, num grafo vazio e fundindo com arestas já existentes
+void testarPoliticasDuplicatas(bool direcionado) {
+    cout << "\n--- insertEdges e DuplicatePolicy (" << (direcionado ? "direcionado" : "nao direcionado") << ") ---" << endl;
+    // 0-1 três vezes (uma como 1-0, outra aresta se direcionado), laço em 2 duas vezes, 1-2 uma vez
+    vector<WeightedEdge> lote = {WeightedEdge(0, 1, 5.0), WeightedEdge(1, 0, 3.0), WeightedEdge(2, 2, 4.0),
+                                 WeightedEdge(0, 1, 2.0), WeightedEdge(1, 2, 7.0), WeightedEdge(2, 2, 1.0)};
+    // 0-1 recebe 5, 2 (direcionado) ou 5, 3, 2; o laço recebe 4, 1
+    const PesosEsperados casos[] = {
+        {DuplicatePolicy::KEEP_FIRST, 5, 6, 4, 3},
+        {DuplicatePolicy::KEEP_MIN, 2, 2, 1, 1},
+        {DuplicatePolicy::SUM, direcionado ? 7.0 : 10.0, direcionado ? 13.0 : 16.0, 5, 8},
+    };
+    for (const PesosEsperados& caso : casos) {
+        for (bool vazio : {true, false}) {
+            WeightedGraph g(3, direcionado);
+            if (!vazio) {
+                g.insertEdge(0, 1, 6.0);
+                g.insertEdge(2, 2, 3.0);
+            }
+            g.insertEdges(lote, caso.politica);
+            string etapa = string(nomePolitica(caso.politica)) + (vazio ? ", grafo vazio" : ", fundindo com 0-1 (6) e 2-2 (3)");
+
+            optional<double> p01 = g.getWeight(0, 1), p22 = g.getWeight(2, 2);
+            bool pesos = p01 == (vazio ? caso.vazio01 : caso.fundido01) &&
+                         p22 == (vazio ? caso.vazio22 : caso.fundido22) && g.getWeight(1, 2) == 7.0;
+            bool ok;
+            if (direcionado) {
+                ok = pesos && g.E() == 4 && g.getWeight(1, 0) == 3.0 && !g.hasEdge(2, 1);
+            } else {
+                // Um laço ocupa uma entrada; as demais arestas, duas (uma em cada ponta)
+                ok = pesos && g.E() == 5 && g.degree(2) == 2 && g.getWeight(1, 0) == p01 &&
+                     g.getWeight(2, 1) == 7.0;
+            }
+            cout << etapa << ": E=" << g.E() << " 0-1=" << p01.value_or(-1) << " 2-2=" << p22.value_or(-1) << endl;
+            conferir(etapa + ": pesos e E()", ok);
+        }
+    }
+}
+
+// Lote fundido num grafo com arestas: mesma ordem de listas que um laço de insertEdge,
+// e cada lista reservada no tamanho exato (a montagem inicial também reserva exato)
+void testarFusaoEmOrdem(bool direcionado) {
+    cout << "\n--- insertEdges fundindo, na ordem da entrada (" << (direcionado ? "direcionado" : "nao direcionado")
+         << ") ---" << endl;
+    const int n = 40;
+    mt19937 rng(direcionado ? 13 : 17);
+    auto sortear = [&](int quantas) {
+        vector<WeightedEdge> arestas;
+        for (int i = 0; i < quantas; ++i) {
+            arestas.push_back(WeightedEdge((int)(rng() % n), (int)(rng() % n), (double)(rng() % 9)));
+        }
+        return arestas;
+    };
+    vector<WeightedEdge> inicial = sortear(200), lote = sortear(300);
+
+    WeightedGraph emLote(n, direcionado), serial(n, direcionado);
+    emLote.insertEdges(inicial);
+    emLote.insertEdges(lote);
+    for (const WeightedEdge& e : inicial) serial.insertEdge(e.v, e.w, e.weight);
+    for (const WeightedEdge& e : lote) serial.insertEdge(e.v, e.w, e.weight);
+
+    bool mesmaOrdem = emLote.E() == serial.E();
+    for (int v = 0; v < n; ++v) {
+        span<const WeightedEdge> a = emLote.neighbors(v), b = serial.neighbors(v);
+        mesmaOrdem = mesmaOrdem && equal(a.begin(), a.end(), b.begin(), b.end(), [](const auto& x, const auto& y) {
+                         return x.w == y.w && x.weight == y.weight;
+                     });
+    }
+    // memoryUsage() conta a capacidade: com reserva exata ela é a de um grafo sem folga
+    vector<WeightedEdge> todas;
+    for (const WeightedEdge& e : emLote.edges()) todas.push_back(e);
+    WeightedGraph semFolga(n, direcionado);
+    semFolga.insertEdges(todas);
+    conferir("KEEP_FIRST: listas iguais as de um laco de insertEdge", mesmaOrdem);
+    conferir("listas reservadas no tamanho exato (memoryUsage sem folga)",
+             emLote.memoryUsage() == semFolga.memoryUsage());
+}
+
+// Vértice fora de [0, V) recusado antes de qualquer escrita, com o grafo intacto
+void testarVerticeInvalido() {
+    cout << "\n--- Vertice fora de [0, V) ---" << endl;
+    vector<WeightedEdge> arestas = {WeightedEdge(0, 1, 1.0), WeightedEdge(2, 4, 1.0)};
+    bool csrRecusou = false;
+    try {
+        CSRGraph::fromEdges(4, arestas, false);
+    } catch (const invalid_argument& e) {
+        cout << "fromEdges: " << e.what() << endl;
+        csrRecusou = true;
+    }
+    conferir("CSRGraph::fromEdges recusa o vertice 4 com V = 4", csrRecusou);
+
+    for (bool vazio : {true, false}) {
+        WeightedGraph g(4, false);
+        if (!vazio) g.insertEdge(0, 1, 1.0);
+        int antes = g.E();
+        bool recusou = false;
+        try {
+            g.insertEdges(arestas);
+        } catch (const invalid_argument&) {
+            recusou = true;
+        }
+        conferir(string("insertEdges recusa em grafo ") + (vazio ? "vazio" : "com arestas") + " e nao altera E()",
+                 recusou && g.E() == antes);
+    }
+}
+
+int main() {
+    cout << "=== Teste: Graph com remocao preguicosa e compact() ===" << endl;
+
+    // Direcionado com laço em 1: remover 1 tira o laço, o arco que sai e os dois que chegam
+    cout << "\n--- Direcionado ---" << endl;
+    Graph dir(4, true);
+    dir.insertEdge(0, 1);
+    dir.insertEdge(1, 1);
+    dir.insertEdge(1, 2);
+    dir.insertEdge(2, 1);
+    dir.insertEdge(2, 3);
+    dir.insertEdge(3, 0);
+    conferirGrafo("Inicial", dir, 6, {{0, 1}, {1, 1}, {1, 2}, {2, 1}, {2, 3}, {3, 0}});
+
+    dir.removeVertex(1);
+    conferirGrafo("removeVertex(1)", dir, 2, {{2, 3}, {3, 0}});
+    conferir("isRemoved(1)", dir.isRemoved(1) && dir.liveVertices() == 3);
+
+    dir.removeEdge(2, 3);
+    conferirGrafo("removeEdge(2, 3)", dir, 1, {{3, 0}});
+
+    vector<int> mapaDir = dir.compact();
+    conferir("compact(): mapa antigo -> novo {0, -1, 1, 2}", mapaDir == vector<int>{0, -1, 1, 2});
+    conferirGrafo("compact() (3->0 vira 2->0)", dir, 1, {{2, 0}});
+
+    // Não direcionado com laço em 2: removeEdge apaga também o espelho
+    cout << "\n--- Nao direcionado ---" << endl;
+    Graph nd(5, false);
+    nd.insertEdge(0, 1);
+    nd.insertEdge(1, 2);
+    nd.insertEdge(2, 2);
+    nd.insertEdge(2, 3);
+    nd.insertEdge(3, 4);
+    nd.insertEdge(4, 0);
+    conferirGrafo("Inicial", nd, 6,
+                  {{0, 1}, {0, 4}, {1, 0}, {1, 2}, {2, 1}, {2, 2}, {2, 3}, {3, 2}, {3, 4}, {4, 3}, {4, 0}});
+
+    nd.removeEdge(3, 4);
+    conferirGrafo("removeEdge(3, 4)", nd, 5, {{0, 1}, {0, 4}, {1, 0}, {1, 2}, {2, 1}, {2, 2}, {2, 3}, {3, 2}, {4, 0}});
+    conferir("espelho removido: hasEdge(4, 3) falso", !nd.hasEdge(4, 3));
+
+    nd.removeVertex(2);
+    conferirGrafo("removeVertex(2)", nd, 2, {{0, 1}, {0, 4}, {1, 0}, {4, 0}});
+
+    vector<int> mapaNd = nd.compact();
+    conferir("compact(): mapa antigo -> novo {0, 1, -1, 2, 3}", mapaNd == vector<int>{0, 1, -1, 2, 3});
+    conferirGrafo("compact() (4-0 vira 3-0)", nd, 2, {{0, 1}, {0, 3}, {1, 0}, {3, 0}});
+
+    nd.insertEdge(2, 3);
+    conferirGrafo("insertEdge(2, 3) nos novos rotulos", nd, 3, {{0, 1}, {0, 3}, {1, 0}, {2, 3}, {3, 0}, {3, 2}});
+
+    cout << "\n=== Teste: WeightedGraph ===" << endl;
+    testarIndiceArestas(true);
+    testarIndiceArestas(false);
+    testarFromEdgesDeterministico(true);
+    testarFromEdgesDeterministico(false);
+    testarPoliticasDuplicatas(true);
+    testarPoliticasDuplicatas(false);
+    testarFusaoEmOrdem(true);
+    testarFusaoEmOrdem(false);
+    testarArestasEntrada();
+    testarVerticeInvalido();
+
+    return resultadoFinal();
+}
@@ -1,53 +1,245 @@
 #include <iostream>
+#include <string>
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
 #include "KruskalMST.h"
+#include "CSRGraph.h"
+#include "UndirectedGraph.h"
+#include "VertexOrdering.h"
+#include "EdgeListReader.h"
+#include "EdgeSort.h"
+#include "CompressedGraph.h"
+#include "Parallel.h"
+#include "TestHelpers.h"
+#include <algorithm>
+#include <cstdint>
+#include <optional>
 
 using namespace std;
 
-void imprimirGrafo(WeightedGraph& g) {
-    double pesoTotal = 0;
-    cout << "--- Estrutura do Grafo ---" << endl;
-    for (int i = 0; i < g.V(); ++i) {
-        WeightedGraph::AdjIterator it(g, i);
-        WeightedEdge e = it.begin();
-        while (true) {
-            if (e.v == -1) break;
-            
-            if (e.v < e.w) {
-                cout << e.v << " - " << e.w << " [Peso: " << e.weight << "]" << endl;
-                pesoTotal += e.weight;
-            }
-            
-            if (it.end()) break;
-            e = it.next();
-        }
-    }
-    cout << "Peso Total: " << pesoTotal << endl;
-    cout << "--------------------------" << endl;
+// Campos de stats() esperados: graus, laços, paralelas e faixa de pesos
+struct FormaEsperada {
+    int minGrau, maxGrau;
+    double mediaGrau;
+    long long lacos, paralelas;
+    double minPeso, maxPeso;
+};
+
+void conferirEstatisticas(const string& nome, const GraphStats& s, size_t memoria, const FormaEsperada& f) {
+    conferir(nome + ": grau min " + to_string(f.minGrau) + ", max " + to_string(f.maxGrau),
+             s.minDegree == f.minGrau && s.maxDegree == f.maxGrau && abs(s.meanDegree - f.mediaGrau) < 1e-9);
+    conferir(nome + ": " + to_string(f.lacos) + " lacos e " + to_string(f.paralelas) + " paralelas",
+             s.selfLoops == f.lacos && s.parallelEdges == f.paralelas);
+    conferir(nome + ": menor e maior peso",
+             s.minWeight == f.minPeso && s.maxWeight == f.maxPeso);
+    conferir(nome + ": memoryBytes == memoryUsage() > 0", s.memoryBytes == memoria && memoria > 0);
 }
 
 int main() {
     cout << "=== Teste Algoritmo de Kruskal ===" << endl;
 
-    int V = 6;
-    WeightedGraph grafo(V, false);
-
-    grafo.insertEdge(0, 1, 4.0);
-    grafo.insertEdge(0, 2, 4.0);
-    grafo.insertEdge(1, 2, 2.0);
-    grafo.insertEdge(1, 0, 4.0); 
-    grafo.insertEdge(2, 3, 3.0);
-    grafo.insertEdge(2, 5, 2.0);
-    grafo.insertEdge(2, 4, 4.0);
-    grafo.insertEdge(3, 4, 3.0);
-    grafo.insertEdge(5, 4, 3.0);
+    WeightedGraph grafo = grafoExemplo();
+    grafo.insertEdge(1, 0, 4.0);  // Repetida no sentido oposto
 
     cout << "\nGrafo Original:" << endl;
     imprimirGrafo(grafo);
+    grafo.stats().print();
+
+    // Multigrafo direcionado com V acima de 4 grãos de 4096 vértices, para que a redução de
+    // stats() use de fato várias threads: v -> v+1 sempre, repetida se v % 10 == 0,
+    // e um laço de peso 0.5 se v % 5 == 0
+    const int nMulti = 20000;
+    vector<WeightedEdge> arestasMulti;
+    for (int v = 0; v < nMulti; ++v) {
+        arestasMulti.push_back(WeightedEdge(v, (v + 1) % nMulti, 1.0 + v % 7));
+        if (v % 10 == 0) arestasMulti.push_back(WeightedEdge(v, (v + 1) % nMulti, 2.0));
+        if (v % 5 == 0) arestasMulti.push_back(WeightedEdge(v, v, 0.5));
+    }
+    CompressedGraph multigrafo = CompressedGraph::fromEdges(nMulti, arestasMulti, true);
+    for (int threads : {1, 4}) {
+        Parallel::setNumThreads(threads);
+        string sufixo = " (" + to_string(threads) + " thread" + (threads > 1 ? "s)" : ")");
+        // Graus 2 (0, 1, 3, 5), 5 (2) e 3 (4): soma 16 em 6 vértices
+        conferirEstatisticas("grafoExemplo" + sufixo, grafo.stats(), grafo.memoryUsage(),
+                             {2, 5, 16.0 / 6, 0, 0, 2.0, 4.0});
+        // Grau 3 se v % 10 == 0, 2 se v % 5 == 0, senão 1: média 1 + 0.1 + 0.2
+        conferirEstatisticas("multigrafo" + sufixo, multigrafo.stats(), multigrafo.memoryUsage(),
+                             {1, 3, 1.3, nMulti / 5, nMulti / 10, 0.5, 7.0});
+    }
+    Parallel::setNumThreads(0);
 
     WeightedGraph mst = KruskalMST::obterArvoreGeradoraMinima(grafo);
 
     cout << "\nGrafo MST (Kruskal):" << endl;
     imprimirGrafo(mst);
 
-    return 0;
+    CSRGraph csr(grafo);
+    WeightedGraph mstCSR = KruskalMST::obterArvoreGeradoraMinima(csr);
+
+    cout << "\nGrafo MST (Kruskal, fotografia CSR):" << endl;
+    imprimirGrafo(mstCSR);
+
+    cout << "\nFloresta MST como vetor de pais:" << endl;
+    imprimirPais(KruskalMST::obterFlorestaGeradora(csr));
+
+    // Grade implícita 3x3: peso = diferença de intensidade entre pixels vizinhos
+    int intensidade[9] = {0, 1, 9,
+                          0, 1, 9,
+                          5, 5, 9};
+    auto difIntensidade = [&](int u, int v) { return (double)abs(intensidade[u] - intensidade[v]); };
+    ImplicitGridGraph<decltype(difIntensidade)> grade(3, 3, difIntensidade);
+
+    cout << "\nFloresta MST de uma grade implicita 3x3:" << endl;
+    SpanningForestResult florestaGrade = KruskalMST::obterFlorestaGeradora(grade);
+    imprimirPais(florestaGrade);
+    conferir("grade 3x3: arvore de 8 arestas e custo 9", florestaGrade.numEdges() == 8 && florestaGrade.totalCost == 9.0);
+
+    // Mesmo grafo lido de uma lista de arestas em CSV (com cabeçalho)
+    FILE* arquivo = fopen("test_kruskal_arestas.csv", "w");
+    fputs("origem,destino,peso\n0,1,4\n0,2,4\n1,2,2\n2,3,3\n2,5,2\n2,4,4\n3,4,3\n5,4,3\n", arquivo);
+    fclose(arquivo);
+    WeightedGraph lido = EdgeListReader::load<double>("test_kruskal_arestas.csv", false);
+    // Mesmo arquivo comprimido em fluxo, sem montar o grafo descomprimido
+    CompressedGraph comprimidoDoArquivo = CompressedGraph::fromEdgeList("test_kruskal_arestas.csv", false);
+    remove("test_kruskal_arestas.csv");
+
+    cout << "\nGrafo MST (Kruskal, lido de CSV):" << endl;
+    WeightedGraph exemplo = grafoExemplo();
+    SpanningForestResult florestaExemplo = KruskalMST::obterFlorestaGeradora(exemplo);
+    SpanningForestResult florestaLida = KruskalMST::obterFlorestaGeradora(lido);
+    imprimirPais(florestaLida);
+    // O leitor ordena cada lista de adjacência: mesmos pais e pesos, posições diferentes
+    conferir("CSV lido: mesma floresta do grafoExemplo()", florestaLida.totalCost == florestaExemplo.totalCost &&
+                                                           florestaLida.parent == florestaExemplo.parent &&
+                                                           florestaLida.parentWeight == florestaExemplo.parentWeight);
+
+    CompressedGraph comprimido(grafo);
+    cout << "\nFloresta MST (Kruskal, adjacencia comprimida, " << comprimido.E() << " arestas):" << endl;
+    imprimirPais(KruskalMST::obterFlorestaGeradora(comprimido));
+    cout << "Comprimido direto do CSV (" << comprimidoDoArquivo.E() << " arestas):" << endl;
+    SpanningForestResult florestaComprimidaLida = KruskalMST::obterFlorestaGeradora(comprimidoDoArquivo);
+    imprimirPais(florestaComprimidaLida);
+    // Mesma ordem de arestas do grafoExemplo() comprimido
+    SpanningForestResult florestaExemploComprimido = KruskalMST::obterFlorestaGeradora(CompressedGraph(exemplo));
+    conferir("CSV comprimido em fluxo: mesma floresta do grafoExemplo()",
+             florestaComprimidaLida.totalCost == florestaExemplo.totalCost &&
+                 mesmaFloresta(florestaComprimidaLida, florestaExemploComprimido));
+
+    // Renumeração RCM: o resultado volta aos rótulos originais (mesmo custo)
+    BasicReorderedGraph<double> rcm = VertexOrdering::reorderVertices(grafo, Ordering::RCM);
+    cout << "\nOrdem RCM (novo -> original):";
+    for (int i = 0; i < rcm.grafo.V(); ++i) cout << " " << rcm.permutacao.toOld(i);
+    cout << endl;
+    SpanningForestResult restaurado = rcm.permutacao.restore(KruskalMST::obterFlorestaGeradora(rcm.grafo));
+    restaurado.locateEdges(grafo);
+    imprimirPais(restaurado);
+    bool bijecao = (int)rcm.permutacao.novoDe.size() == grafo.V() && (int)rcm.permutacao.antigoDe.size() == grafo.V();
+    vector<char> visto(grafo.V(), 0);
+    for (int v = 0; bijecao && v < grafo.V(); ++v) {
+        int novo = rcm.permutacao.toNew(v);
+        bijecao = novo >= 0 && novo < grafo.V() && !visto[novo] && rcm.permutacao.toOld(novo) == v;
+        if (bijecao) visto[novo] = 1;
+    }
+    conferir("RCM: permutacao e uma bijecao (toOld inverte toNew)", bijecao);
+    conferir("RCM: floresta restaurada com o custo da original",
+             restaurado.totalCost == KruskalMST::obterFlorestaGeradora(grafo).totalCost);
+
+    // Armazenamento único: cada aresta uma vez no array global
+    UndirectedGraph unico(grafo);
+    cout << "\nUndirectedGraph: " << unico.E() << " arestas (WeightedGraph: " << grafo.E() << " entradas)" << endl;
+    conferir("uma entrada por aresta (8), contra as 2 * 8 do WeightedGraph", unico.E() == 8 && grafo.E() == 16);
+    unico.updateWeight(4, 2, 1.0);
+    conferir("updateWeight(4, 2, 1.0) visto de 2 - 4", unico.getWeight(2, 4) == 1.0);
+    unico.removeEdge(0, 2);
+    conferir("removeEdge(0, 2): hasEdge(2, 0) falso e E() == 7", !unico.hasEdge(2, 0) && unico.E() == 7);
+    conferir("removeEdge(0, 2): getWeight(0, 2) vazio", !unico.getWeight(0, 2));
+
+    // Sem sentinela: em uint16_t o peso 65535 é válido e distinto de aresta ausente
+    BasicUndirectedGraph<uint16_t> pesosCurtos(3);
+    pesosCurtos.insertEdge(0, 1, 65535);
+    std::optional<uint16_t> presente = pesosCurtos.getWeight(1, 0), ausente = pesosCurtos.getWeight(1, 2);
+    conferir("uint16_t: peso de 0 - 1 = 65535", presente == uint16_t(65535));
+    conferir("uint16_t: 1 - 2 ausente", !ausente);
+
+    cout << "\nFloresta MST (Kruskal, UndirectedGraph ordenado no lugar):" << endl;
+    imprimirPais(KruskalMST::obterFlorestaGeradoraNoLugar(unico));
+
+    ComponentLabels componentes = KruskalMST::obterComponentesAteLimiar(unico, 2.0);
+    cout << "\nComponentes com arestas de peso <= 2 (" << componentes.count << "):";
+    for (int v = 0; v < unico.V(); ++v) cout << " " << v << "->" << componentes.label[v];
+    cout << endl;
+    // Referência: conjunto disjunto direto sobre as arestas de peso <= 2, rótulos na ordem
+    // do menor vértice de cada componente
+    vector<int> raizRef(unico.V());
+    for (int v = 0; v < unico.V(); ++v) raizRef[v] = v;
+    auto buscarRef = [&](int v) {
+        while (raizRef[v] != v) v = raizRef[v];
+        return v;
+    };
+    for (const auto& e : unico.edges()) {
+        if (e.weight <= 2.0) raizRef[buscarRef(e.v)] = buscarRef(e.w);
+    }
+    vector<int> rotuloRef(unico.V(), -1), rotuloDaRaiz(unico.V(), -1);
+    int numRef = 0;
+    for (int v = 0; v < unico.V(); ++v) {
+        int r = buscarRef(v);
+        if (rotuloDaRaiz[r] == -1) rotuloDaRaiz[r] = numRef++;
+        rotuloRef[v] = rotuloDaRaiz[r];
+    }
+    conferir("limiar 2: mesmas componentes das arestas de peso <= 2",
+             componentes.count == numRef && componentes.label == rotuloRef);
+
+    // Pesos inteiros em faixa pequena: ordenação por contagem em vez de comparação
+    vector<WeightedEdge> lote;
+    for (int i = 0; i < 1000; ++i) lote.push_back(WeightedEdge(i, i + 1, (i * 37) % 100));
+    WeightSort metodo = EdgeSort::byWeight<double>(lote);
+    bool ordenado = is_sorted(lote.begin(), lote.end(), [](const WeightedEdge& a, const WeightedEdge& b) {
+        return a.weight < b.weight;
+    });
+    cout << "\nEdgeSort em 1000 arestas com pesos 0..99:" << endl;
+    conferir("escolhe contagem", metodo == WeightSort::COUNTING);
+    conferir("ordenado por peso", ordenado);
+
+    // Métodos forçados fora do seu domínio: contagem com pesos fracionários cai para
+    // radix; radix sobre lista vazia não faz nada
+    vector<BasicWeightedEdge<float>> fracionarios;
+    for (int i = 0; i < 300; ++i) fracionarios.push_back(BasicWeightedEdge<float>(i, i + 1, i % 7 + 0.5f * (i % 3)));
+    WeightSort forcado = EdgeSort::byWeight<float>(fracionarios, WeightSort::COUNTING);
+    bool fracOrdenado = is_sorted(fracionarios.begin(), fracionarios.end(),
+                                  [](const auto& a, const auto& b) { return a.weight < b.weight; });
+    conferir("COUNTING forcado em pesos fracionarios cai para radix", forcado == WeightSort::RADIX);
+    conferir("COUNTING forcado em pesos fracionarios: ordenado por peso", fracOrdenado);
+    vector<WeightedEdge> vazia;
+    EdgeSort::byWeight<double>(vazia, WeightSort::RADIX);
+    conferir("RADIX forcado em lista vazia: continua vazia", vazia.empty());
+
+    // Grafo denso o bastante para o Filter-Kruskal particionar e filtrar: a floresta deve
+    // ser a da ordenação completa (UndirectedGraph ordenado no lugar)
+    int n = 5000;
+    UndirectedGraph denso = grafoAleatorio(7, n, 40 * n, n, 1000, 10);
+    for (int threads : {1, 4}) {
+        Parallel::setNumThreads(threads);
+        SpanningForestResult filtrada = KruskalMST::obterFlorestaGeradora(denso);
+        UndirectedGraph copia(denso);
+        SpanningForestResult completa = KruskalMST::obterFlorestaGeradoraNoLugar(copia);
+        cout << "Filter-Kruskal em " << denso.E() << " arestas, " << threads << " thread(s): custo "
+             << filtrada.totalCost << endl;
+        conferir("mesma floresta da ordenacao completa com " + to_string(threads) + " thread(s)",
+                 filtrada.parent == completa.parent && filtrada.parentWeight == completa.parentWeight);
+    }
+    Parallel::setNumThreads(0);
+
+    // Comprimido montado em fluxo e Kruskal em passadas de até 2000 candidatas: mesma
+    // floresta de uma passada só, e o custo da floresta do UndirectedGraph
+    CompressedGraph densoComprimido = CompressedGraph::fromEdges(n, denso.edges(), false);
+    SpanningForestResult emPassadas = KruskalMST::obterFlorestaGeradora(densoComprimido, 2000);
+    SpanningForestResult umaPassada = KruskalMST::obterFlorestaGeradora(densoComprimido, densoComprimido.E());
+    SpanningForestResult descomprimido = KruskalMST::obterFlorestaGeradora(denso);
+    cout << "Kruskal comprimido em passadas: custo " << emPassadas.totalCost << " (UndirectedGraph "
+         << descomprimido.totalCost << ")" << endl;
+    conferir("passadas de 2000: mesma floresta de uma passada", mesmaFloresta(emPassadas, umaPassada));
+    conferir("passadas de 2000: custo do UndirectedGraph", abs(emPassadas.totalCost - descomprimido.totalCost) < 1e-6);
+
+    return resultadoFinal();
 }
\ No newline at end of file
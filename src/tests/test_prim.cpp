@@ -0,0 +1,84 @@
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include "PrimMST.h"
+#include "KruskalMST.h"
+#include "CSRGraph.h"
+#include "UndirectedGraph.h"
+#include "StrategyRunner.h"
+#include "Parallel.h"
+#include "TestHelpers.h"
+
+using namespace std;
+
+int main() {
+    cout << "=== Teste Algoritmo de Prim ===" << endl;
+
+    // Mesmo grafo do teste do Kruskal (com empates de peso)
+    WeightedGraph grafo = grafoExemplo();
+
+    WeightedGraph mst = PrimMST::obterArvoreGeradoraMinima(grafo);
+    cout << "\nGrafo MST (Prim):" << endl;
+    imprimirGrafo(mst);
+
+    cout << "\nFloresta MST como vetor de pais (fotografia CSR):" << endl;
+    CSRGraph csr(grafo);
+    SpanningForestResult pequena = PrimMST::obterFlorestaGeradora(csr);
+    imprimirPais(pequena);
+    conferir("mesma floresta do Kruskal no grafo de exemplo",
+             mesmaFloresta(pequena, KruskalMST::obterFlorestaGeradora(csr)));
+
+    // Grafo maior, desconexo e com muitos empates: a floresta deve ser a do Kruskal
+    int n = 2000;
+    UndirectedGraph grande = grafoAleatorio(42, n, 50 * n, n - 20, 50);
+    SpanningForestResult kruskal = KruskalMST::obterFlorestaGeradora(grande);
+    SpanningForestResult prim = PrimMST::obterFlorestaGeradora(grande);
+    cout << "\n" << grande.V() << " vertices, " << grande.E() << " arestas: custo " << prim.totalCost
+         << " (Kruskal " << kruskal.totalCost << ")" << endl;
+    conferir("mesma floresta do Kruskal no grafo aleatorio", mesmaFloresta(prim, kruskal));
+
+    // Grafo completo: o caso em que o heap compensa
+    mt19937 rng(42);
+    int m = 300;
+    UndirectedGraph completo(m);
+    for (int a = 0; a < m; ++a) {
+        for (int b = a + 1; b < m; ++b) completo.insertEdge(a, b, (double)(rng() % 1000));
+    }
+    SpanningForestResult primCompleto = PrimMST::obterFlorestaGeradora(completo);
+    SpanningForestResult kruskalCompleto = KruskalMST::obterFlorestaGeradora(completo);
+    cout << "Completo com " << completo.V() << " vertices: custo " << primCompleto.totalCost
+         << " (Kruskal " << kruskalCompleto.totalCost << ")" << endl;
+    conferir("mesma floresta do Kruskal no grafo completo", mesmaFloresta(primCompleto, kruskalCompleto));
+
+    // Motor do modo automático para alguns formatos de grafo
+    cout << "\nAUTO_MST:" << endl;
+    auto conferirMotor = [](long long numV, long long numE, int threads, Strategy esperada) {
+        Strategy escolhida = StrategyRunner::choose(numV, numE, threads);
+        conferir("V=" + to_string(numV) + ", E=" + to_string(numE) + ", " + to_string(threads) + " thread(s): " +
+                     StrategyRunner::name(escolhida) + " (esperado " + StrategyRunner::name(esperada) + ")",
+                 escolhida == esperada);
+    };
+    conferirMotor(grande.V(), grande.E(), 1, Strategy::KRUSKAL_MST);
+    conferirMotor(completo.V(), completo.E(), 1, Strategy::PRIM_MST);
+    // Denso mas pequeno: abaixo de ARESTAS_PARALELO o Prim vence mesmo com várias threads
+    conferirMotor(completo.V(), completo.E(), 8, Strategy::PRIM_MST);
+    conferirMotor(100000, 200000, 1, Strategy::KRUSKAL_MST);
+    conferirMotor(100000, 200000, 8, Strategy::BORUVKA_MST);
+
+    // StrategyRunner sobre o UndirectedGraph: o motor resolvido é o de choose e a floresta a do Kruskal
+    Parallel::setNumThreads(1);
+    Strategy motorCompleto = StrategyRunner::resolve(completo, Strategy::AUTO_MST);
+    conferir("resolve(completo, AUTO_MST) == Prim", motorCompleto == Strategy::PRIM_MST);
+    conferir("run(completo, AUTO_MST): floresta do Kruskal",
+             mesmaFloresta(StrategyRunner::run(completo, Strategy::AUTO_MST), kruskalCompleto));
+    Parallel::setNumThreads(0);
+    bool recusou = false;
+    try {
+        StrategyRunner::run(completo, Strategy::EDMONDS_MSA);
+    } catch (const invalid_argument&) {
+        recusou = true;
+    }
+    conferir("run(UndirectedGraph, EDMONDS_MSA) lanca invalid_argument", recusou);
+
+    return resultadoFinal();
+}
@@ -1,26 +1,55 @@
 #include <iostream>
+#include <random>
+#include <string>
+#include <vector>
 #include "WeightedGraph.h"
 #include "TarjanMST.h"
+#include "EdmondsMST.h"
+#include "GabowMST.h"
+#include "CSRGraph.h"
+#include "TestHelpers.h"
 
 using namespace std;
 
 void imprimirResultado(WeightedGraph& g) {
     double pesoTotal = 0;
     cout << "--- Arborescencia Gerada (Tarjan) ---" << endl;
-    for (int i = 0; i < g.V(); ++i) {
-        WeightedGraph::AdjIterator it(g, i);
-        WeightedEdge e = it.begin();
-        while (e.v != -1) {
-            cout << e.v << " -> " << e.w << " [Peso: " << e.weight << "]" << endl;
-            pesoTotal += e.weight;
-            if (it.end()) break;
-            e = it.next();
-        }
+    for (const WeightedEdge& e : g.edges()) {
+        cout << e.v << " -> " << e.w << " [Peso: " << e.weight << "]" << endl;
+        pesoTotal += e.weight;
     }
     cout << "Peso Total: " << pesoTotal << endl;
     cout << "-------------------------------------" << endl;
 }
 
+void imprimirPais(const ArborescenceResult& r) {
+    cout << "--- Vetor de Pais ---" << endl;
+    for (int v = 0; v < r.V(); ++v) {
+        if (r.parent[v] == -1) continue;
+        cout << r.parent[v] << " -> " << v << " [Peso: " << r.parentWeight[v] << ", aresta #" << r.edgeId[v] << "]" << endl;
+    }
+    cout << "Peso Total: " << r.totalCost << endl;
+}
+
+// Custo da arborescência, ou -1 se algum vértice não tem exatamente um pai ou não
+// chega à raiz subindo pelos pais
+double custoSeValida(const WeightedGraph& arb, int raiz) {
+    int n = arb.V();
+    vector<int> pai(n, -1);
+    double custo = 0;
+    for (const WeightedEdge& e : arb.edges()) {
+        if (e.w == raiz || pai[e.w] != -1) return -1;
+        pai[e.w] = e.v;
+        custo += e.weight;
+    }
+    for (int v = 0; v < n; ++v) {
+        int u = v, passos = 0;
+        while (u != raiz && u != -1 && passos++ <= n) u = pai[u];
+        if (u != raiz) return -1;
+    }
+    return custo;
+}
+
 int main() {
     cout << "=== Teste: Algoritmo de Tarjan ===" << endl;
 
@@ -39,5 +68,62 @@ int main() {
     
     imprimirResultado(mst);
 
-    return 0;
+    cout << "Calculando via fotografia CSR..." << endl;
+    CSRGraph csr(grafo);
+    WeightedGraph mstCSR = TarjanMST::obterArborescencia(csr, 0);
+    imprimirResultado(mstCSR);
+
+    cout << "Calculando como vetor de pais..." << endl;
+    imprimirPais(TarjanMST::obterPaisArborescencia(csr, 0));
+
+    // Vértice 2 sem aresta de entrada e ciclo 3 <-> 4 sem entrada vinda da raiz:
+    // nenhum dos três solvers pode relatar sucesso
+    cout << "\nSem arborescencia (success deve ser 0 nos tres):" << endl;
+    WeightedGraph orfao(3, true);
+    orfao.insertEdge(0, 1, 1.0);
+    WeightedGraph cicloIsolado(5, true);
+    cicloIsolado.insertEdge(0, 1, 1.0);
+    cicloIsolado.insertEdge(1, 2, 1.0);
+    cicloIsolado.insertEdge(3, 4, 1.0);
+    cicloIsolado.insertEdge(4, 3, 1.0);
+    for (WeightedGraph* g : {&orfao, &cicloIsolado}) {
+        bool edmonds = EdmondsMST::obterPaisArborescencia(*g, 0).success;
+        bool tarjan = TarjanMST::obterPaisArborescencia(*g, 0).success;
+        bool gabow = GabowMST::obterPaisArborescencia(*g, 0).success;
+        conferir("V=" + to_string(g->V()) + ": nenhum solver relata sucesso", !edmonds && !tarjan && !gabow);
+    }
+
+    // Ciclo 1 <-> 2 cujo arco mais barato (2 -> 1, peso 0) não fica na resposta: a
+    // contração tem de descontar o custo reduzido, senão sobra o ciclo
+    cout << "\nCom ciclo contraido (custo deve ser o do Edmonds):" << endl;
+    WeightedGraph contracao(3, true);
+    contracao.insertEdge(0, 1, 8.0);
+    contracao.insertEdge(2, 1, 0.0);
+    contracao.insertEdge(1, 2, 6.0);
+    contracao.insertEdge(0, 2, 9.0);
+    conferir("V=3 com ciclo contraido: arborescencia valida de custo 9",
+             custoSeValida(TarjanMST::obterArborescencia(contracao, 0), 0) == 9.0);
+
+    // Grafos aleatórios com arborescência garantida (uma árvore aleatória a partir da raiz
+    // mais arcos extras) e pesos com muitos empates
+    mt19937 rng(2024);
+    int divergentes = 0;
+    int casos = 2000;
+    for (int caso = 0; caso < casos; ++caso) {
+        int n = 2 + (int)(rng() % 12);
+        WeightedGraph g(n, true);
+        for (int v = 1; v < n; ++v) g.insertEdge((int)(rng() % v), v, (double)(rng() % 10));
+        int extras = (int)(rng() % (2 * n));
+        for (int k = 0; k < extras; ++k) {
+            int a = (int)(rng() % n), b = (int)(rng() % n);
+            if (a != b && !g.hasEdge(a, b)) g.insertEdge(a, b, (double)(rng() % 10));
+        }
+        double edmonds = custoSeValida(EdmondsMST::obterArborescencia(g, 0), 0);
+        double tarjan = custoSeValida(TarjanMST::obterArborescencia(g, 0), 0);
+        double gabow = custoSeValida(GabowMST::obterArborescencia(g, 0), 0);
+        if (edmonds < 0 || tarjan != edmonds || gabow != edmonds) divergentes++;
+    }
+    conferir(to_string(casos) + " grafos aleatorios: Tarjan e Gabow com o custo do Edmonds", divergentes == 0);
+
+    return resultadoFinal();
 }
\ No newline at end of file